@@ -12,6 +12,10 @@ namespace kf {
 enum class PixelFormat : u8 {
     Monochrome,///< 1-bit monochrome format (1 bit per pixel)
     RGB565,    ///< 16-bit BIG ENDIAN RGB565 format (5-6-5 bits per channel)
+    Gray4,     ///< 4-bit grayscale (two pixels per byte, left pixel in high nibble)
+    RGB332,    ///< 8-bit RGB332 format (3-3-2 bits per channel)
+    Indexed4,  ///< 4-bit palette index (two pixels per byte, left pixel in high nibble)
+    Indexed8,  ///< 8-bit palette index
 };
 
 }// namespace kf
\ No newline at end of file
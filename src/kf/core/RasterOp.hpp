@@ -0,0 +1,19 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/aliases.hpp"
+
+
+namespace kf {
+
+/// @brief Raster operation applied when combining source pixels with destination
+enum class RasterOp : u8 {
+    Copy,  ///< dest = source
+    Or,    ///< dest = dest | source (draw set bits only)
+    AndNot,///< dest = dest & ~source (erase by mask)
+    Xor,   ///< dest = dest ^ source (invert by mask)
+};
+
+}// namespace kf
@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <cstring>
+
 #include "kf/algorithm.hpp"
 #include "kf/aliases.hpp"
 #include "kf/core/PixelFormat.hpp"
+#include "kf/core/RasterOp.hpp"
 #include "kf/math/units.hpp"
 
 
@@ -23,9 +26,11 @@ template<> struct pixel_traits<PixelFormat::Monochrome> {
 
     static constexpr u8 bits_per_pixel = 1;///< Bits per pixel
     static constexpr u8 page_height = 8;   ///< Vertical pixels per memory page
+    static constexpr usize palette_size = 0;///< Pixel values are panel colors, no palette
 
     /// @brief Calculate buffer size for given dimensions
-    template<usize W, usize H> static constexpr usize buffer_size = ((W * H) + 7) / 8;
+    /// @details Page layout: W bytes per each started 8-pixel page
+    template<usize W, usize H> static constexpr usize buffer_size = W * ((H + 7) / 8);
 
     /// @brief Calculate number of memory pages for given height
     /// @return Number of 8-pixel memory pages
@@ -55,6 +60,9 @@ template<> struct pixel_traits<PixelFormat::Monochrome> {
     }
 
     /// @brief Fill rectangular region with specified value
+    /// @details Region is clipped horizontally to stride and vertically to zero once per call.
+    /// Fully covered pages are written with bulk stores (single store over contiguous pages
+    /// when region spans whole stride), partial top and bottom pages are merged through masks.
     static void fill(
         BufferType *buffer,
         Pixel stride,
@@ -64,111 +72,598 @@ template<> struct pixel_traits<PixelFormat::Monochrome> {
         Pixel height,
         ColorType value
     ) noexcept {
-        const auto start_page = static_cast<Pixel>(offset_y / page_height);
-        const auto end_page = static_cast<Pixel>((offset_y + height + page_height - 1) / page_height);
+        const auto x0 = kf::max<i32>(offset_x, 0);
+        const auto x1 = kf::min<i32>(offset_x + width, stride);
+        const auto y0 = kf::max<i32>(offset_y, 0);
+        const auto y1 = static_cast<i32>(offset_y + height);
+
+        if (x0 >= x1 or y0 >= y1) { return; }
+
+        const auto span = static_cast<usize>(x1 - x0);
+        const auto first_page = static_cast<usize>(y0 / page_height);
+        const auto last_page = static_cast<usize>((y1 - 1) / page_height);
         const u8 fill_byte = value ? 0xFF : 0x00;
 
-        for (Pixel page = start_page; page < end_page; page += 1) {
-            const u8 mask = calculatePageMask(page, offset_y, height);
-            if (mask == 0) { continue; }
+        const u8 top_mask = createMask(static_cast<u8>(y0 % page_height), page_height - 1);
+        const u8 bottom_mask = createMask(0, static_cast<u8>((y1 - 1) % page_height));
+
+        BufferType *row = buffer + first_page * stride + x0;
+
+        if (first_page == last_page) {
+            fillMasked(row, span, top_mask & bottom_mask, fill_byte);
+            return;
+        }
+
+        usize full_begin = first_page;
+        usize full_end = last_page + 1;
+
+        if (top_mask != 0xFF) {
+            fillMasked(row, span, top_mask, fill_byte);
+            full_begin += 1;
+        }
+
+        if (bottom_mask != 0xFF) {
+            fillMasked(buffer + last_page * stride + x0, span, bottom_mask, fill_byte);
+            full_end -= 1;
+        }
+
+        if (full_begin >= full_end) { return; }
+
+        if (span == static_cast<usize>(stride)) {
+            // Whole pages are contiguous in memory
+            std::memset(buffer + full_begin * stride, fill_byte, (full_end - full_begin) * span);
+            return;
+        }
+
+        for (usize page = full_begin; page < full_end; page += 1) {
+            std::memset(buffer + page * stride + x0, fill_byte, span);
+        }
+    }
+
+    /// @brief Copy rectangular region from buffer of the same geometry (e.g. background layer)
+    /// @details Region is clipped like fill(). Whole pages are copied with memcpy,
+    /// partial top and bottom pages are merged through row masks.
+    /// @param buffer Destination buffer
+    /// @param source Source buffer with the same stride and page layout
+    static void copyRect(
+        BufferType *buffer,
+        const BufferType *source,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height
+    ) noexcept {
+        const auto x0 = kf::max<i32>(offset_x, 0);
+        const auto x1 = kf::min<i32>(offset_x + width, stride);
+        const auto y0 = kf::max<i32>(offset_y, 0);
+        const auto y1 = static_cast<i32>(offset_y + height);
+
+        if (x0 >= x1 or y0 >= y1) { return; }
+
+        const auto span = static_cast<usize>(x1 - x0);
+        const auto first_page = static_cast<usize>(y0 / page_height);
+        const auto last_page = static_cast<usize>((y1 - 1) / page_height);
+
+        const u8 top_mask = createMask(static_cast<u8>(y0 % page_height), page_height - 1);
+        const u8 bottom_mask = createMask(0, static_cast<u8>((y1 - 1) % page_height));
+
+        for (usize page = first_page; page <= last_page; page += 1) {
+            u8 mask = 0xFF;
+            if (page == first_page) { mask &= top_mask; }
+            if (page == last_page) { mask &= bottom_mask; }
+
+            BufferType *row = buffer + page * stride + x0;
+            const BufferType *source_row = source + page * stride + x0;
+
+            if (mask == 0xFF) {
+                std::memcpy(row, source_row, span);
+                continue;
+            }
+
+            const u8 keep = static_cast<u8>(~mask);
+            for (usize i = 0; i < span; i += 1) {
+                row[i] = static_cast<u8>((row[i] & keep) | (source_row[i] & mask));
+            }
+        }
+    }
+
+    /// @brief Move contents of region by (dx, dy) in place
+    /// @details Region is clipped like fill(). Page rows are processed away from the move direction,
+    /// each destination byte is combined from two adjacent source pages (bits carried between pages),
+    /// page-aligned moves are plain memmove of page rows. Pixels moved past region edges are dropped,
+    /// the uncovered strip keeps its previous contents.
+    static void scroll(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel dx,
+        Pixel dy
+    ) noexcept {
+        const auto x0 = kf::max<i32>(offset_x, 0);
+        const auto x1 = kf::min<i32>(offset_x + width, stride);
+        const auto y0 = kf::max<i32>(offset_y, 0);
+        const auto y1 = static_cast<i32>(offset_y + height);
+
+        // Destination part whose source lies inside region
+        const auto dest_x0 = kf::max<i32>(x0, x0 + dx);
+        const auto dest_x1 = kf::min<i32>(x1, x1 + dx);
+        const auto dest_y0 = kf::max<i32>(y0, y0 + dy);
+        const auto dest_y1 = kf::min<i32>(y1, y1 + dy);
+
+        if (dest_x0 >= dest_x1 or dest_y0 >= dest_y1) { return; }
+
+        const auto span = static_cast<usize>(dest_x1 - dest_x0);
+        const auto first_page = dest_y0 / page_height;
+        const auto last_page = (dest_y1 - 1) / page_height;
+
+        const u8 top_mask = createMask(static_cast<u8>(dest_y0 % page_height), page_height - 1);
+        const u8 bottom_mask = createMask(0, static_cast<u8>((dest_y1 - 1) % page_height));
+
+        // Row r of destination page p comes from page p - page_delta shifted by shift bits,
+        // rows above shift come from the page before it
+        const i32 page_delta = (dy >= 0) ? dy / page_height : -((page_height - 1 - dy) / page_height);
+        const auto shift = static_cast<u8>(dy - page_delta * page_height);
 
-            for (Pixel x = 0; x < width; x += 1) {
-                const auto abs_x = offset_x + x;
-                if (abs_x < 0 or abs_x >= stride) { continue; }
+        const auto source_first_page = (dest_y0 - dy) / page_height;
+        const auto source_last_page = (dest_y1 - 1 - dy) / page_height;
 
-                const usize index = page * stride + abs_x;
-                buffer[index] = (buffer[index] & ~mask) | (fill_byte & mask);
+        // Sources lie above destination when moving down: walk pages bottom-up (and columns right to left)
+        const i32 page_step = (dy > 0) ? -1 : 1;
+        const auto page_begin = (dy > 0) ? last_page : first_page;
+        const auto page_end = (dy > 0) ? first_page - 1 : last_page + 1;
+
+        for (auto page = page_begin; page != page_end; page += page_step) {
+            u8 mask = 0xFF;
+            if (page == first_page) { mask &= top_mask; }
+            if (page == last_page) { mask &= bottom_mask; }
+
+            BufferType *dest = buffer + page * stride + dest_x0;
+
+            const auto source_page = page - page_delta;
+            const auto carry_page = source_page - 1;
+
+            const BufferType *source = (source_page <= source_last_page)
+                ? buffer + source_page * stride + (dest_x0 - dx) : nullptr;
+            const BufferType *carry = (shift != 0 and carry_page >= source_first_page)
+                ? buffer + carry_page * stride + (dest_x0 - dx) : nullptr;
+
+            if (shift == 0 and mask == 0xFF) {
+                std::memmove(dest, source, span);
+                continue;
+            }
+
+            const u8 keep = static_cast<u8>(~mask);
+
+            for (usize n = 0; n < span; n += 1) {
+                const usize i = (dx > 0) ? span - 1 - n : n;
+
+                u8 bits = 0;
+                if (nullptr != source) { bits |= static_cast<u8>(source[i] << shift); }
+                if (nullptr != carry) { bits |= static_cast<u8>(carry[i] >> (page_height - shift)); }
+
+                dest[i] = static_cast<u8>((dest[i] & keep) | (bits & mask));
             }
         }
     }
 
-    /// @brief Copy rectangular region from source to destination buffer
+    /// @brief Copy source image into destination window
+    /// @details Source is stored in the same page layout (source_width bytes per page).
+    /// Each destination byte is combined from two adjacent source pages shifted by the
+    /// Y offset, so any vertical position is supported. Clipping is computed once per call.
+    /// @param buffer Destination buffer
+    /// @param stride Destination row stride
+    /// @param offset_x Absolute X offset of destination window
+    /// @param offset_y Absolute Y offset of destination window
+    /// @param width Destination window width
+    /// @param height Destination window height
+    /// @param x Image left position relative to window
+    /// @param y Image top position relative to window
+    /// @param source Source image buffer
+    /// @param source_width Source image width
+    /// @param source_height Source image height
+    /// @param op Raster operation to combine source with destination
     static void copy(
-        const BufferType *source_buffer,
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const BufferType *source,
         Pixel source_width,
         Pixel source_height,
-        BufferType *dest_buffer,
-        Pixel dest_stride,
-        Pixel dest_width,
-        Pixel dest_height,
-        Pixel dest_x,
-        Pixel dest_y
+        RasterOp op = RasterOp::Copy
     ) noexcept {
+        switch (op) {
+            case RasterOp::Copy:
+                blit<RasterOp::Copy>(buffer, stride, offset_x, offset_y, width, height, x, y, source, source_width, source_height);
+                return;
+            case RasterOp::Or:
+                blit<RasterOp::Or>(buffer, stride, offset_x, offset_y, width, height, x, y, source, source_width, source_height);
+                return;
+            case RasterOp::AndNot:
+                blit<RasterOp::AndNot>(buffer, stride, offset_x, offset_y, width, height, x, y, source, source_width, source_height);
+                return;
+            case RasterOp::Xor:
+                blit<RasterOp::Xor>(buffer, stride, offset_x, offset_y, width, height, x, y, source, source_width, source_height);
+                return;
+        }
+    }
 
-        // Boundary checks
-        if (dest_x >= dest_width or dest_y >= dest_height) { return; }
+    /// @brief Draw 1-bit bitmap with color pair
+    /// @details Bitmap uses page layout (bit 0 of each column byte is the top pixel),
+    /// for monochrome target it is written directly by the page blitter:
+    /// page-aligned rows are masked byte stores, unaligned rows are two-page shifted writes.
+    /// @param bitmap Bitmap column bytes, bitmap_width bytes per page
+    /// @param bitmap_width Bitmap width in pixels
+    /// @param bitmap_height Bitmap height in pixels
+    /// @param on Color of set bits
+    /// @param off Color of clear bits
+    static void bitmap(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const u8 *bitmap,
+        Pixel bitmap_width,
+        Pixel bitmap_height,
+        ColorType on,
+        ColorType off
+    ) noexcept {
+        if (on == off) {
+            const auto x0 = kf::max<i32>(x, 0);
+            const auto y0 = kf::max<i32>(y, 0);
+            const auto x1 = kf::min<i32>(x + bitmap_width, width);
+            const auto y1 = kf::min<i32>(y + bitmap_height, height);
 
-        int copy_width = source_width;
-        int copy_height = source_height;
+            if (x0 >= x1 or y0 >= y1) { return; }
 
-        if (dest_x + copy_width > dest_width) {
-            copy_width = dest_width - dest_x;
+            fill(buffer, stride,
+                 static_cast<Pixel>(offset_x + x0), static_cast<Pixel>(offset_y + y0),
+                 static_cast<Pixel>(x1 - x0), static_cast<Pixel>(y1 - y0),
+                 on);
+            return;
         }
-        if (dest_y + copy_height > dest_height) {
-            copy_height = dest_height - dest_y;
+
+        blit<RasterOp::Copy>(
+            buffer, stride, offset_x, offset_y, width, height, x, y,
+            bitmap, bitmap_width, bitmap_height,
+            on ? 0x00 : 0xFF);
+    }
+
+    /// @brief Copy source image skipping pixels of key color
+    /// @details For 1-bit pixels the key leaves a single opaque color, so the copy is a
+    /// page blitter pass: key 0 sets source bits (Or), key 1 clears bits of inverted source (AndNot).
+    /// @param key Transparent color
+    static void copyKeyed(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const BufferType *source,
+        Pixel source_width,
+        Pixel source_height,
+        ColorType key
+    ) noexcept {
+        if (key) {
+            blit<RasterOp::AndNot>(buffer, stride, offset_x, offset_y, width, height, x, y, source, source_width, source_height, 0xFF);
+        } else {
+            blit<RasterOp::Or>(buffer, stride, offset_x, offset_y, width, height, x, y, source, source_width, source_height);
         }
+    }
+
+    /// @brief Copy source image through 1-bit alpha mask
+    /// @details Mask has source dimensions and page layout. Source and mask bytes are shifted
+    /// to destination pages together and merged as (dest & ~mask) | (source & mask).
+    /// @param mask Mask column bytes, set bits mark opaque pixels
+    static void copyMasked(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const BufferType *source,
+        Pixel source_width,
+        Pixel source_height,
+        const u8 *mask
+    ) noexcept {
+        const auto col_begin = kf::max<i32>(x, 0);
+        const auto col_end = kf::min<i32>(x + source_width, width);
+        const auto row_begin = kf::max<i32>(y, 0);
+        const auto row_end = kf::min<i32>(y + source_height, height);
+
+        if (col_begin >= col_end or row_begin >= row_end) { return; }
+
+        const i32 abs_y0 = offset_y + row_begin;
+        const i32 abs_y1 = offset_y + row_end;
+        const i32 origin_y = offset_y + y;
+
+        const i32 origin_page = (origin_y >= 0) ? origin_y / page_height : -((page_height - 1 - origin_y) / page_height);
+        const auto shift = static_cast<u8>(origin_y - origin_page * page_height);
 
-        if (copy_width <= 0 or copy_height <= 0) { return; }
+        const auto columns = static_cast<usize>(col_end - col_begin);
+        const auto source_pages = static_cast<i32>((source_height + page_height - 1) / page_height);
+        const i32 first_page = abs_y0 / page_height;
+        const i32 last_page = (abs_y1 - 1) / page_height;
 
-        const usize source_pages = (source_height + page_height - 1) / page_height;
+        const auto column_offset = static_cast<usize>(col_begin - x);
+        BufferType *dest_column = buffer + offset_x + col_begin;
 
-        for (auto src_page = 0; src_page < source_pages; src_page += 1) {
-            const auto src_y_start = src_page * page_height;
-            const auto src_y_end = kf::min(src_y_start + page_height, copy_height);
+        // Source or mask byte moved to destination page from lower (k) and upper (k - 1) source pages
+        const auto shifted = [shift, source_width, source_pages](const u8 *column, i32 k, usize i) -> u8 {
+            u8 bits = 0;
+            if (k >= 0 and k < source_pages) {
+                bits |= static_cast<u8>(column[k * source_width + i] << shift);
+            }
+            if (shift != 0 and k >= 1 and k - 1 < source_pages) {
+                bits |= static_cast<u8>(column[(k - 1) * source_width + i] >> (page_height - shift));
+            }
+            return bits;
+        };
 
-            if (src_y_start >= src_y_end) { continue; }
+        for (i32 page = first_page; page <= last_page; page += 1) {
+            const i32 page_top = page * page_height;
+            const u8 clip_mask = createMask(
+                static_cast<u8>(kf::max(abs_y0, page_top) - page_top),
+                static_cast<u8>(kf::min(abs_y1, page_top + page_height) - 1 - page_top));
 
-            const usize rows_in_page = src_y_end - src_y_start;
-            const auto dest_y_start = dest_y + src_y_start;
-            const usize dest_page = dest_y_start / page_height;
+            const i32 k = page - origin_page;
+            BufferType *dest = dest_column + page * stride;
 
-            const u8 src_bit_offset = static_cast<u8>(src_y_start % page_height);
-            const u8 dest_bit_offset = static_cast<u8>(dest_y_start % page_height);
+            for (usize i = 0; i < columns; i += 1) {
+                const auto alpha = static_cast<u8>(shifted(mask + column_offset, k, i) & clip_mask);
+                if (alpha == 0) { continue; }
 
-            // Destination bit mask
-            u8 dest_mask = 0;
-            for (usize i = 0; i < rows_in_page; i += 1) {
-                dest_mask |= static_cast<u8>(1 << (dest_bit_offset + i));
+                dest[i] = combine<RasterOp::Copy>(dest[i], shifted(source + column_offset, k, i), alpha);
             }
+        }
+    }
+
+    /// @brief Draw set bits of 1-bit bitmap, clear bits are transparent
+    /// @details Single page blitter pass: Or for on color, AndNot for off color
+    /// @param on Color of set bits
+    static void bitmapTransparent(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const u8 *bitmap,
+        Pixel bitmap_width,
+        Pixel bitmap_height,
+        ColorType on
+    ) noexcept {
+        if (on) {
+            blit<RasterOp::Or>(buffer, stride, offset_x, offset_y, width, height, x, y, bitmap, bitmap_width, bitmap_height);
+        } else {
+            blit<RasterOp::AndNot>(buffer, stride, offset_x, offset_y, width, height, x, y, bitmap, bitmap_width, bitmap_height);
+        }
+    }
 
-            for (auto x = 0; x < copy_width; x += 1) {
-                const auto dest_col = dest_x + x;
-                if (dest_col >= dest_stride) { continue; }
+    /// @brief Transpose 8x8 pixel block: bit j of source byte k becomes bit k of destination byte j
+    /// @details Turns 8 page columns into 8 page columns of the block rotated about its diagonal,
+    /// the basis of 90/270 degree page buffer rotation. Three delta swaps on a 64-bit word.
+    /// @param source First source byte
+    /// @param source_step Distance between source bytes (negative to read columns right to left)
+    /// @param destination First destination byte
+    /// @param destination_step Distance between destination bytes
+    static void transpose(
+        const BufferType *source, isize source_step,
+        BufferType *destination, isize destination_step
+    ) noexcept {
+        u64 block = 0;
+        for (u8 k = 0; k < page_height; k += 1) {
+            block |= static_cast<u64>(source[k * source_step]) << (k * 8);
+        }
 
-                // Read from source
-                const usize src_index = src_page * source_width + x;
-                const u8 src_byte = source_buffer[src_index];
+        // Bit 8k + j holds pixel (column k, row j): swap across main diagonal
+        u64 t = (block ^ (block >> 7)) & 0x00AA00AA00AA00AAull;
+        block ^= t ^ (t << 7);
+        t = (block ^ (block >> 14)) & 0x0000CCCC0000CCCCull;
+        block ^= t ^ (t << 14);
+        t = (block ^ (block >> 28)) & 0x00000000F0F0F0F0ull;
+        block ^= t ^ (t << 28);
 
-                // Extract and shift bits
-                u8 src_bits = 0;
-                for (usize i = 0; i < rows_in_page; i += 1) {
-                    if (src_byte & static_cast<u8>(1 << (src_bit_offset + i))) {
-                        src_bits |= static_cast<u8>(1 << (dest_bit_offset + i));
-                    }
+        for (u8 j = 0; j < page_height; j += 1) {
+            destination[j * destination_step] = static_cast<u8>(block >> (j * 8));
+        }
+    }
+
+    /// @brief Decode packbits-compressed page layout image into fill and copy operations
+    /// @details Stream covers image pages in order, each page image_width bytes.
+    /// Header byte n: 0..127 - n + 1 literal bytes follow, -1..-127 - next byte repeats 1 - n times,
+    /// -128 - no operation. Runs of blank or solid bytes become fills, other runs are
+    /// expanded into a stack row and copied, literals are copied from the stream in place.
+    /// @param fill Called as fill(x0, y0, x1, y1, color), inclusive bounds relative to image
+    /// @param copy Called as copy(x, y, bytes, width, height) for single page source
+    template<typename Fill, typename Copy> static void decode(
+        const BufferType *data, usize size,
+        Pixel image_width, Pixel image_height,
+        Fill &&fill, Copy &&copy
+    ) noexcept {
+        const usize total = static_cast<usize>(image_width) * ((image_height + page_height - 1) / page_height);
+        usize position = 0;
+        usize i = 0;
+
+        while (i < size and position < total) {
+            const auto header = static_cast<i8>(data[i]);
+            i += 1;
+
+            if (header == -128) { continue; }
+
+            const bool is_run = header < 0;
+            if (is_run and i >= size) { return; }
+
+            auto count = kf::min<usize>(is_run ? 1 - header : header + 1, total - position);
+            count = is_run ? count : kf::min(count, size - i);
+
+            const u8 value = is_run ? data[i] : 0;
+            const BufferType *literal = data + i;
+            i += is_run ? 1 : count;
+
+            while (count > 0) {
+                const auto page = static_cast<Pixel>(position / image_width);
+                const auto column = static_cast<Pixel>(position % image_width);
+                const auto span = kf::min<usize>(count, image_width - column);
+                const auto top = static_cast<Pixel>(page * page_height);
+                const auto rows = static_cast<Pixel>(kf::min<i32>(page_height, image_height - top));
+                const auto right = static_cast<Pixel>(column + span - 1);
+
+                if (not is_run) {
+                    copy(column, top, literal, static_cast<Pixel>(span), rows);
+                    literal += span;
+                } else if (value == 0x00 or value == 0xFF) {
+                    fill(column, top, right, static_cast<Pixel>(top + rows - 1), value != 0);
+                } else {
+                    // Patterned run: one page copy (runs are at most 128 bytes)
+                    u8 pattern[128];
+                    std::memset(pattern, value, span);
+                    copy(column, top, pattern, static_cast<Pixel>(span), rows);
                 }
 
-                // Write to destination (clear old bits first)
-                const usize dest_index = dest_page * dest_stride + dest_col;
-                dest_buffer[dest_index] = (dest_buffer[dest_index] & ~dest_mask) | (src_bits & dest_mask);
+                position += span;
+                count -= span;
             }
         }
     }
 
 private:
-    /// @brief Calculate page mask for specified region
-    /// @return Bit mask for the visible portion of the page
-    static u8 calculatePageMask(Pixel page, Pixel offset_y, Pixel height) noexcept {
-        const auto page_top = static_cast<Pixel>(page * page_height);
-        const auto page_bottom = static_cast<Pixel>(page_top + page_height - 1);
+    /// @brief Combine source bits with destination byte under mask
+    template<RasterOp Op> static inline u8 combine(u8 dest, u8 source, u8 mask) noexcept {
+        switch (Op) {
+            case RasterOp::Copy:
+                return static_cast<u8>((dest & ~mask) | (source & mask));
+            case RasterOp::Or:
+                return static_cast<u8>(dest | (source & mask));
+            case RasterOp::AndNot:
+                return static_cast<u8>(dest & ~(source & mask));
+            case RasterOp::Xor:
+                return static_cast<u8>(dest ^ (source & mask));
+        }
+        return dest;
+    }
+
+    /// @brief Page blitter backend for specific raster operation
+    /// @param invert Mask applied (XOR) to source bits before combining
+    template<RasterOp Op> static void blit(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const BufferType *source,
+        Pixel source_width,
+        Pixel source_height,
+        u8 invert = 0x00
+    ) noexcept {
+        const auto col_begin = kf::max<i32>(x, 0);
+        const auto col_end = kf::min<i32>(x + source_width, width);
+        const auto row_begin = kf::max<i32>(y, 0);
+        const auto row_end = kf::min<i32>(y + source_height, height);
+
+        if (col_begin >= col_end or row_begin >= row_end) { return; }
+
+        // Absolute vertical range and image origin
+        const i32 abs_y0 = offset_y + row_begin;
+        const i32 abs_y1 = offset_y + row_end;
+        const i32 origin_y = offset_y + y;
+
+        // Floor division: origin may be above the buffer top
+        const i32 origin_page = (origin_y >= 0) ? origin_y / page_height : -((page_height - 1 - origin_y) / page_height);
+        const auto shift = static_cast<u8>(origin_y - origin_page * page_height);
+
+        const auto columns = static_cast<usize>(col_end - col_begin);
+        const auto source_pages = static_cast<i32>((source_height + page_height - 1) / page_height);
+        const i32 first_page = abs_y0 / page_height;
+        const i32 last_page = (abs_y1 - 1) / page_height;
+
+        const BufferType *source_column = source + (col_begin - x);
+        BufferType *dest_column = buffer + offset_x + col_begin;
+
+        for (i32 page = first_page; page <= last_page; page += 1) {
+            const i32 page_top = page * page_height;
+            const u8 mask = createMask(
+                static_cast<u8>(kf::max(abs_y0, page_top) - page_top),
+                static_cast<u8>(kf::min(abs_y1, page_top + page_height) - 1 - page_top));
+
+            // Source pages overlapping this destination page: lower (k) and upper (k - 1)
+            const i32 k = page - origin_page;
+            const BufferType *lower = (k >= 0 and k < source_pages) ? source_column + k * source_width : nullptr;
+            const BufferType *upper = (shift != 0 and k >= 1 and k - 1 < source_pages) ? source_column + (k - 1) * source_width : nullptr;
+
+            BufferType *dest = dest_column + page * stride;
+
+            if (nullptr != lower and nullptr != upper) {
+                for (usize i = 0; i < columns; i += 1) {
+                    const auto bits = static_cast<u8>((lower[i] << shift) | (upper[i] >> (page_height - shift)));
+                    dest[i] = combine<Op>(dest[i], static_cast<u8>(bits ^ invert), mask);
+                }
+            } else if (nullptr != lower) {
+                for (usize i = 0; i < columns; i += 1) {
+                    dest[i] = combine<Op>(dest[i], static_cast<u8>((lower[i] << shift) ^ invert), mask);
+                }
+            } else if (nullptr != upper) {
+                for (usize i = 0; i < columns; i += 1) {
+                    dest[i] = combine<Op>(dest[i], static_cast<u8>((upper[i] >> (page_height - shift)) ^ invert), mask);
+                }
+            }
+        }
+    }
+
+    /// @brief Merge fill byte into a row of page bytes through mask
+    /// @details Processes 32-bit words in the aligned middle part of the row
+    /// (loaded and stored with memcpy, which compiles to plain word accesses without aliasing the buffer)
+    static void fillMasked(BufferType *row, usize count, u8 mask, u8 fill_byte) noexcept {
+        if (mask == 0xFF) {
+            std::memset(row, fill_byte, count);
+            return;
+        }
 
-        const Pixel visible_top = kf::max(offset_y, page_top);
-        const auto visible_bottom = static_cast<Pixel>(kf::min(offset_y + height, page_bottom + 1));
+        const u8 keep = static_cast<u8>(~mask);
+        const u8 set = static_cast<u8>(fill_byte & mask);
 
-        if (visible_top >= visible_bottom) { return 0; }
+        while (count > 0 and (reinterpret_cast<uintptr_t>(row) & (sizeof(u32) - 1)) != 0) {
+            *row = static_cast<u8>((*row & keep) | set);
+            row += 1;
+            count -= 1;
+        }
+
+        const u32 keep_word = keep * 0x01010101u;
+        const u32 set_word = set * 0x01010101u;
+
+        for (; count >= sizeof(u32); count -= sizeof(u32), row += sizeof(u32)) {
+            u32 word;
+            std::memcpy(&word, row, sizeof(word));
+            word = (word & keep_word) | set_word;
+            std::memcpy(row, &word, sizeof(word));
+        }
 
-        return createMask(
-            static_cast<u8>(visible_top - page_top),
-            static_cast<u8>(visible_bottom - page_top - 1));
+        for (; count > 0; count -= 1, row += 1) {
+            *row = static_cast<u8>((*row & keep) | set);
+        }
     }
 
     /// @brief Create bit mask for specified bit range
@@ -189,6 +684,7 @@ template<> struct pixel_traits<PixelFormat::RGB565> {
     using ColorType = u16; ///< Color representation type (RGB565 format)
 
     static constexpr u8 bits_per_pixel = 16;///< Bits per pixel
+    static constexpr usize palette_size = 0;///< Pixel values are panel colors, no palette
 
     /// @brief Calculate buffer size for given dimensions
     /// @return Required buffer size in elements (W * H)
@@ -200,6 +696,20 @@ template<> struct pixel_traits<PixelFormat::RGB565> {
         return static_cast<ColorType>(((color & 0xFF) << 8) | (color >> 8));
     }
 
+    /// @brief Perceived brightness of buffer color
+    /// @return Luma 0..255 (BT.601 weights)
+    static constexpr u8 luminance(ColorType color) noexcept {
+        const auto native = static_cast<u16>((color >> 8) | (color << 8));
+        const auto r5 = static_cast<u8>(native >> 11);
+        const auto g6 = static_cast<u8>((native >> 5) & 0x3F);
+        const auto b5 = static_cast<u8>(native & 0x1F);
+
+        const u32 r = (r5 << 3) | (r5 >> 2);
+        const u32 g = (g6 << 2) | (g6 >> 4);
+        const u32 b = (b5 << 3) | (b5 >> 2);
+        return static_cast<u8>((r * 77 + g * 150 + b * 29) >> 8);
+    }
+
     /// @brief Set pixel value in RGB565 buffer
     static void setPixel(
         BufferType *buffer,
@@ -212,6 +722,8 @@ template<> struct pixel_traits<PixelFormat::RGB565> {
     }
 
     /// @brief Fill rectangular region with specified color
+    /// @details Region is clipped horizontally to stride and vertically to zero once per call.
+    /// Rows are written with packed native-word stores, contiguous rows as a single run.
     static void fill(
         BufferType *buffer,
         Pixel stride,
@@ -221,59 +733,1235 @@ template<> struct pixel_traits<PixelFormat::RGB565> {
         Pixel height,
         ColorType color
     ) noexcept {
-        for (usize y = 0; y < height; y += 1) {
-            const auto abs_y = offset_y + y;
-            const usize row_start = abs_y * stride + offset_x;
+        const auto x0 = kf::max<i32>(offset_x, 0);
+        const auto x1 = kf::min<i32>(offset_x + width, stride);
+        const auto y0 = kf::max<i32>(offset_y, 0);
+        const auto y1 = static_cast<i32>(offset_y + height);
 
-            for (usize x = 0; x < width; x += 1) {
-                buffer[row_start + x] = color;
+        if (x0 >= x1 or y0 >= y1) { return; }
+
+        const auto span = static_cast<usize>(x1 - x0);
+        const auto rows = static_cast<usize>(y1 - y0);
+        const Word pattern = makePattern(color);
+        BufferType *row = buffer + y0 * stride + x0;
+
+        if (span == static_cast<usize>(stride)) {
+            fillRow(row, span * rows, color, pattern);
+            return;
+        }
+
+        if (span < 2 * pixels_per_word) {
+            // Narrow region (vertical lines, glyph columns): alignment bookkeeping costs more than it saves
+            for (usize i = 0; i < rows; i += 1, row += stride) {
+                for (usize x = 0; x < span; x += 1) {
+                    row[x] = color;
+                }
             }
+            return;
+        }
+
+        for (usize i = 0; i < rows; i += 1, row += stride) {
+            fillRow(row, span, color, pattern);
+        }
+    }
+
+    /// @brief Copy rectangular region from buffer of the same geometry (e.g. background layer)
+    /// @details Region is clipped like fill(), each row is one memcpy (one for all rows when full width).
+    /// @param buffer Destination buffer
+    /// @param source Source buffer with the same stride
+    static void copyRect(
+        BufferType *buffer,
+        const BufferType *source,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height
+    ) noexcept {
+        const auto x0 = kf::max<i32>(offset_x, 0);
+        const auto x1 = kf::min<i32>(offset_x + width, stride);
+        const auto y0 = kf::max<i32>(offset_y, 0);
+        const auto y1 = static_cast<i32>(offset_y + height);
+
+        if (x0 >= x1 or y0 >= y1) { return; }
+
+        const auto span = static_cast<usize>(x1 - x0);
+        const auto rows = static_cast<usize>(y1 - y0);
+        const auto start = static_cast<usize>(y0 * stride + x0);
+
+        if (span == static_cast<usize>(stride)) {
+            std::memcpy(buffer + start, source + start, span * rows * sizeof(BufferType));
+            return;
+        }
+
+        for (usize i = 0, at = start; i < rows; i += 1, at += stride) {
+            std::memcpy(buffer + at, source + at, span * sizeof(BufferType));
+        }
+    }
+
+    /// @brief Move contents of region by (dx, dy) in place
+    /// @details Region is clipped like fill(). Rows are moved with memmove away from the move direction
+    /// (single memmove when whole rows move vertically). Pixels moved past region edges are dropped,
+    /// the uncovered strip keeps its previous contents.
+    static void scroll(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel dx,
+        Pixel dy
+    ) noexcept {
+        const auto x0 = kf::max<i32>(offset_x, 0);
+        const auto x1 = kf::min<i32>(offset_x + width, stride);
+        const auto y0 = kf::max<i32>(offset_y, 0);
+        const auto y1 = static_cast<i32>(offset_y + height);
+
+        // Destination part whose source lies inside region
+        const auto dest_x0 = kf::max<i32>(x0, x0 + dx);
+        const auto dest_x1 = kf::min<i32>(x1, x1 + dx);
+        const auto dest_y0 = kf::max<i32>(y0, y0 + dy);
+        const auto dest_y1 = kf::min<i32>(y1, y1 + dy);
+
+        if (dest_x0 >= dest_x1 or dest_y0 >= dest_y1) { return; }
+
+        const auto span = static_cast<usize>(dest_x1 - dest_x0);
+        const auto rows = static_cast<usize>(dest_y1 - dest_y0);
+        const auto source_shift = static_cast<isize>(dy) * stride + dx;
+
+        if (span == static_cast<usize>(stride)) {
+            const auto start = static_cast<usize>(dest_y0 * stride);
+            std::memmove(buffer + start, buffer + start - source_shift, span * rows * sizeof(BufferType));
+            return;
+        }
+
+        // Sources lie above destination when moving down: walk rows bottom-up
+        const auto first_row = (dy > 0) ? dest_y1 - 1 : dest_y0;
+        const isize row_step = (dy > 0) ? -stride : stride;
+        BufferType *row = buffer + first_row * stride + dest_x0;
+
+        for (usize i = 0; i < rows; i += 1, row += row_step) {
+            std::memmove(row, row - source_shift, span * sizeof(BufferType));
         }
     }
 
-    /// @brief Copy rectangular region from source to destination buffer
+    /// @brief Copy source image into destination window
+    /// @param buffer Destination buffer
+    /// @param stride Destination row stride
+    /// @param offset_x Absolute X offset of destination window
+    /// @param offset_y Absolute Y offset of destination window
+    /// @param width Destination window width
+    /// @param height Destination window height
+    /// @param x Image left position relative to window
+    /// @param y Image top position relative to window
+    /// @param source Source image buffer (row-major, source_width pixels per row)
+    /// @param source_width Source image width
+    /// @param source_height Source image height
+    /// @param op Raster operation to combine source with destination
     static void copy(
-        const BufferType *source_buffer,
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const BufferType *source,
         Pixel source_width,
         Pixel source_height,
-        BufferType *dest_buffer,
-        Pixel dest_stride,
-        Pixel dest_width,
-        Pixel dest_height,
-        Pixel dest_x,
-        Pixel dest_y
+        RasterOp op = RasterOp::Copy
     ) noexcept {
+        const auto col_begin = kf::max<i32>(x, 0);
+        const auto col_end = kf::min<i32>(x + source_width, width);
+        const auto row_begin = kf::max<i32>(y, 0);
+        const auto row_end = kf::min<i32>(y + source_height, height);
 
-        // Boundary checks
-        if (dest_x >= dest_width or dest_y >= dest_height) { return; }
+        if (col_begin >= col_end or row_begin >= row_end) { return; }
 
-        int copy_width = source_width;
-        int copy_height = source_height;
+        const auto columns = static_cast<usize>(col_end - col_begin);
+        const auto rows = static_cast<usize>(row_end - row_begin);
+        const BufferType *source_row = source + (row_begin - y) * source_width + (col_begin - x);
+        BufferType *dest_row = buffer + (offset_y + row_begin) * stride + offset_x + col_begin;
 
-        if (dest_x + copy_width > dest_width) {
-            copy_width = dest_width - dest_x;
-        }
-        if (dest_y + copy_height > dest_height) {
-            copy_height = dest_height - dest_y;
+        switch (op) {
+            case RasterOp::Copy:
+                if (columns == static_cast<usize>(stride) and columns == static_cast<usize>(source_width)) {
+                    // Both source and destination rows are contiguous
+                    std::memcpy(dest_row, source_row, columns * rows * sizeof(BufferType));
+                    return;
+                }
+                for (usize i = 0; i < rows; i += 1, source_row += source_width, dest_row += stride) {
+                    std::memcpy(dest_row, source_row, columns * sizeof(BufferType));
+                }
+                return;
+            case RasterOp::Or:
+                blit<RasterOp::Or>(dest_row, stride, source_row, source_width, columns, rows);
+                return;
+            case RasterOp::AndNot:
+                blit<RasterOp::AndNot>(dest_row, stride, source_row, source_width, columns, rows);
+                return;
+            case RasterOp::Xor:
+                blit<RasterOp::Xor>(dest_row, stride, source_row, source_width, columns, rows);
+                return;
         }
+    }
+
+    /// @brief Draw 1-bit bitmap with color pair
+    /// @details Bitmap uses monochrome page layout (bit 0 of each column byte is the top pixel).
+    /// Blocks of 8 columns are transposed into row bytes, each row byte is expanded through
+    /// a nibble lookup table into two 4-pixel stores. Remaining columns are expanded pixel by pixel.
+    /// @param bitmap Bitmap column bytes, bitmap_width bytes per page
+    /// @param bitmap_width Bitmap width in pixels
+    /// @param bitmap_height Bitmap height in pixels
+    /// @param on Color of set bits
+    /// @param off Color of clear bits
+    static void bitmap(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const u8 *bitmap,
+        Pixel bitmap_width,
+        Pixel bitmap_height,
+        ColorType on,
+        ColorType off
+    ) noexcept {
+        expand<false>(buffer, stride, offset_x, offset_y, width, height, x, y, bitmap, bitmap_width, bitmap_height, on, off);
+    }
+
+    /// @brief Draw set bits of 1-bit bitmap, clear bits are transparent
+    /// @details Blank row bytes of transposed 8-column blocks skip 8 pixels at once
+    /// @param on Color of set bits
+    static void bitmapTransparent(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const u8 *bitmap,
+        Pixel bitmap_width,
+        Pixel bitmap_height,
+        ColorType on
+    ) noexcept {
+        expand<true>(buffer, stride, offset_x, offset_y, width, height, x, y, bitmap, bitmap_width, bitmap_height, on, on);
+    }
+
+    /// @brief Copy source image skipping pixels of key color
+    /// @details Transparent runs are skipped a native word (several pixels) per comparison
+    /// once the source is word-aligned, opaque runs between them are copied with memcpy.
+    /// @param key Transparent color
+    static void copyKeyed(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const BufferType *source,
+        Pixel source_width,
+        Pixel source_height,
+        ColorType key
+    ) noexcept {
+        const auto col_begin = kf::max<i32>(x, 0);
+        const auto col_end = kf::min<i32>(x + source_width, width);
+        const auto row_begin = kf::max<i32>(y, 0);
+        const auto row_end = kf::min<i32>(y + source_height, height);
 
-        if (copy_width <= 0 or copy_height <= 0) { return; }
+        if (col_begin >= col_end or row_begin >= row_end) { return; }
 
-        for (usize y = 0; y < copy_height; y += 1) {
-            const auto dest_row = dest_y + y;
-            if (dest_row >= dest_height) { break; }
+        const auto columns = static_cast<usize>(col_end - col_begin);
+        const auto rows = static_cast<usize>(row_end - row_begin);
+        const Word pattern = makePattern(key);
+        const BufferType *source_row = source + (row_begin - y) * source_width + (col_begin - x);
+        BufferType *dest_row = buffer + (offset_y + row_begin) * stride + offset_x + col_begin;
 
-            const usize src_row_start = y * source_width;
-            const usize dest_row_start = dest_row * dest_stride + dest_x;
+        for (usize r = 0; r < rows; r += 1, source_row += source_width, dest_row += stride) {
+            usize i = 0;
+            while (i < columns) {
+                i = skipKey(source_row, i, columns, key, pattern);
 
-            for (usize x = 0; x < copy_width; x += 1) {
-                const auto dest_col = dest_x + x;
-                if (dest_col >= dest_width) { break; }
+                usize end = i;
+                while (end < columns and source_row[end] != key) { end += 1; }
 
-                dest_buffer[dest_row_start + x] = source_buffer[src_row_start + x];
+                std::memcpy(dest_row + i, source_row + i, (end - i) * sizeof(BufferType));
+                i = end;
             }
         }
     }
+
+    /// @brief Copy source image through 1-bit alpha mask
+    /// @details Mask has source dimensions and monochrome page layout (as bitmap)
+    /// @param mask Mask column bytes, set bits mark opaque pixels
+    static void copyMasked(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const BufferType *source,
+        Pixel source_width,
+        Pixel source_height,
+        const u8 *mask
+    ) noexcept {
+        const auto col_begin = kf::max<i32>(x, 0);
+        const auto col_end = kf::min<i32>(x + source_width, width);
+        const auto row_begin = kf::max<i32>(y, 0);
+        const auto row_end = kf::min<i32>(y + source_height, height);
+
+        if (col_begin >= col_end or row_begin >= row_end) { return; }
+
+        const BufferType *source_row = source + (row_begin - y) * source_width;
+        BufferType *dest_row = buffer + (offset_y + row_begin) * stride + offset_x;
+
+        for (i32 row = row_begin; row < row_end; row += 1, source_row += source_width, dest_row += stride) {
+            const auto mask_row = row - y;
+            const u8 *bits = mask + (mask_row / 8) * source_width;
+            const auto bit = static_cast<u8>(1 << (mask_row % 8));
+
+            for (i32 col = col_begin; col < col_end; col += 1) {
+                if (bits[col - x] & bit) {
+                    dest_row[col] = source_row[col - x];
+                }
+            }
+        }
+    }
+
+    /// @brief Decode RLE-compressed image into fill and copy operations
+    /// @details Stream covers image pixels row by row, runs may cross rows.
+    /// Header word: bit 15 set - run, next word is color repeated (header & 0x7FFF) times,
+    /// bit 15 clear - (header & 0x7FFF) literal pixels follow. Whole rows are merged
+    /// into a single fill or copy, literals are copied from the stream in place.
+    /// @param fill Called as fill(x0, y0, x1, y1, color), inclusive bounds relative to image
+    /// @param copy Called as copy(x, y, pixels, width, height), rows are width pixels apart
+    template<typename Fill, typename Copy> static void decode(
+        const BufferType *data, usize size,
+        Pixel image_width, Pixel image_height,
+        Fill &&fill, Copy &&copy
+    ) noexcept {
+        constexpr BufferType run_flag = 0x8000;
+
+        const usize total = static_cast<usize>(image_width) * image_height;
+        usize position = 0;
+        usize i = 0;
+
+        while (i < size and position < total) {
+            const BufferType header = data[i];
+            i += 1;
+
+            const bool is_run = header & run_flag;
+            if (is_run and i >= size) { return; }
+
+            auto count = kf::min<usize>(header & ~run_flag, total - position);
+            count = is_run ? count : kf::min(count, size - i);
+
+            const ColorType color = is_run ? data[i] : 0;
+            const BufferType *literal = data + i;
+            i += is_run ? 1 : count;
+
+            while (count > 0) {
+                const auto row = static_cast<Pixel>(position / image_width);
+                const auto column = static_cast<Pixel>(position % image_width);
+
+                // Whole rows at once when aligned, otherwise up to end of row
+                const auto full_rows = (column == 0) ? count / image_width : 0;
+                const auto span = (full_rows > 0) ? full_rows * image_width : kf::min<usize>(count, image_width - column);
+                const auto width = static_cast<Pixel>((full_rows > 0) ? image_width : span);
+                const auto height = static_cast<Pixel>((full_rows > 0) ? full_rows : 1);
+
+                if (is_run) {
+                    fill(column, row, static_cast<Pixel>(column + width - 1), static_cast<Pixel>(row + height - 1), color);
+                } else {
+                    copy(column, row, literal, width, height);
+                    literal += span;
+                }
+
+                position += span;
+                count -= span;
+            }
+        }
+    }
+
+private:
+    /// @brief Native machine word used for packed stores
+    using Word = uintptr_t;
+
+    /// @brief Pixels per native word
+    static constexpr usize pixels_per_word = sizeof(Word) / sizeof(BufferType);
+
+    /// @brief Replicate color into every pixel slot of native word
+    static Word makePattern(ColorType color) noexcept {
+        Word pattern = color;
+        for (usize i = 1; i < pixels_per_word; i += 1) {
+            pattern = (pattern << bits_per_pixel) | color;
+        }
+        return pattern;
+    }
+
+    /// @brief Fill row with packed word stores
+    /// @details Leading pixels are stored one by one up to word alignment, trailing pixels after last full word.
+    /// Words are stored with memcpy, which compiles to plain word stores without aliasing the u16 buffer
+    static void fillRow(BufferType *row, usize count, ColorType color, Word pattern) noexcept {
+        while (count > 0 and (reinterpret_cast<uintptr_t>(row) & (sizeof(Word) - 1)) != 0) {
+            *row = color;
+            row += 1;
+            count -= 1;
+        }
+
+        for (; count >= pixels_per_word; count -= pixels_per_word) {
+            std::memcpy(row, &pattern, sizeof(Word));
+            row += pixels_per_word;
+        }
+
+        for (; count > 0; count -= 1) {
+            *row = color;
+            row += 1;
+        }
+    }
+
+    /// @brief Expand page layout bitmap into pixels
+    /// @tparam Transparent Leave pixels of clear bits untouched
+    template<bool Transparent> static void expand(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const u8 *bitmap,
+        Pixel bitmap_width,
+        Pixel bitmap_height,
+        ColorType on,
+        ColorType off
+    ) noexcept {
+        using Mono = pixel_traits<PixelFormat::Monochrome>;
+        constexpr i32 block = Mono::page_height;
+
+        const auto col_begin = kf::max<i32>(x, 0);
+        const auto col_end = kf::min<i32>(x + bitmap_width, width);
+        const auto row_begin = kf::max<i32>(y, 0);
+        const auto row_end = kf::min<i32>(y + bitmap_height, height);
+
+        if (col_begin >= col_end or row_begin >= row_end) { return; }
+
+        const ColorType colors[2] = {off, on};
+        const i32 blocks_end = col_begin + (col_end - col_begin) / block * block;
+
+        // Nibble of row byte -> 4 pixels, built on first full block (narrow glyphs never need it)
+        BufferType lut[16][4];
+        bool lut_ready = Transparent;
+
+        const i32 first_page = (row_begin - y) / block;
+        const i32 last_page = (row_end - 1 - y) / block;
+
+        for (i32 page = first_page; page <= last_page; page += 1) {
+            const i32 page_top = y + page * block;
+            const i32 r0 = kf::max(row_begin, page_top);
+            const i32 r1 = kf::min(row_end, page_top + block);
+            const u8 *page_bits = bitmap + page * bitmap_width;
+
+            for (i32 col = col_begin; col < blocks_end; col += block) {
+                if (not lut_ready) {
+                    for (u8 n = 0; n < 16; n += 1) {
+                        for (u8 k = 0; k < 4; k += 1) {
+                            lut[n][k] = colors[(n >> k) & 1];
+                        }
+                    }
+                    lut_ready = true;
+                }
+
+                u8 rows[block];
+                Mono::transpose(page_bits + (col - x), 1, rows, 1);
+
+                for (i32 row = r0; row < r1; row += 1) {
+                    const u8 bits = rows[row - page_top];
+                    BufferType *dest = buffer + (offset_y + row) * stride + offset_x + col;
+
+                    if (Transparent) {
+                        for (u8 k = 0; bits >> k; k += 1) {
+                            if ((bits >> k) & 1) { dest[k] = on; }
+                        }
+                    } else {
+                        std::memcpy(dest, lut[bits & 0x0F], sizeof(lut[0]));
+                        std::memcpy(dest + 4, lut[bits >> 4], sizeof(lut[0]));
+                    }
+                }
+            }
+
+            for (i32 row = r0; row < r1; row += 1) {
+                const auto bit = static_cast<u8>(1 << (row - page_top));
+                BufferType *dest_row = buffer + (offset_y + row) * stride + offset_x;
+
+                for (i32 col = blocks_end; col < col_end; col += 1) {
+                    const bool set = page_bits[col - x] & bit;
+                    if (Transparent and not set) { continue; }
+                    dest_row[col] = colors[set];
+                }
+            }
+        }
+    }
+
+    /// @brief Skip pixels of key color starting at index
+    /// @details Compares whole native words (memcpy loads) against key pattern in the aligned middle part
+    /// @return Index of first non-key pixel or count
+    static usize skipKey(const BufferType *row, usize i, usize count, ColorType key, Word pattern) noexcept {
+        while (i < count and row[i] == key and (reinterpret_cast<uintptr_t>(row + i) & (sizeof(Word) - 1)) != 0) {
+            i += 1;
+        }
+
+        if (i < count and row[i] == key) {
+            for (; i + pixels_per_word <= count; i += pixels_per_word) {
+                Word word;
+                std::memcpy(&word, row + i, sizeof(word));
+                if (word != pattern) { break; }
+            }
+        }
+
+        while (i < count and row[i] == key) { i += 1; }
+        return i;
+    }
+
+    /// @brief Row blitter backend for bitwise raster operations
+    template<RasterOp Op> static void blit(
+        BufferType *dest_row,
+        Pixel stride,
+        const BufferType *source_row,
+        Pixel source_width,
+        usize columns,
+        usize rows
+    ) noexcept {
+        for (usize r = 0; r < rows; r += 1, source_row += source_width, dest_row += stride) {
+            for (usize i = 0; i < columns; i += 1) {
+                switch (Op) {
+                    case RasterOp::Copy:
+                        dest_row[i] = source_row[i];
+                        break;
+                    case RasterOp::Or:
+                        dest_row[i] |= source_row[i];
+                        break;
+                    case RasterOp::AndNot:
+                        dest_row[i] &= static_cast<BufferType>(~source_row[i]);
+                        break;
+                    case RasterOp::Xor:
+                        dest_row[i] ^= source_row[i];
+                        break;
+                }
+            }
+        }
+    }
+};
+
+/// @brief Shared backend of byte-packed formats (rows start on byte boundary)
+/// @tparam Bits Bits per pixel: 4 (two pixels per byte, left pixel in high nibble) or 8
+/// @details Buffer values are shown through a palette of 1 << Bits RGB565 colors
+/// (see toRgb565 of concrete formats), drivers of RGB565 panels expand rows with expandRow while sending.
+template<u8 Bits> struct packed_pixel_traits {
+    static_assert(Bits == 4 or Bits == 8, "Bits must be 4 or 8");
+
+    using BufferType = u8;///< Buffer element type (u8)
+    using ColorType = u8; ///< Color representation type (pixel value)
+
+    static constexpr u8 bits_per_pixel = Bits;           ///< Bits per pixel
+    static constexpr u8 pixels_per_byte = 8 / Bits;      ///< Pixels packed into buffer byte
+    static constexpr usize palette_size = usize{1} << Bits;///< Number of distinct pixel values
+
+    /// @brief Calculate buffer size for given dimensions
+    /// @details Row layout: each row starts on byte boundary
+    template<usize W, usize H> static constexpr usize buffer_size = (W + pixels_per_byte - 1) / pixels_per_byte * H;
+
+    /// @brief Buffer bytes per row of given width
+    static constexpr usize rowSize(usize width) noexcept { return (width + pixels_per_byte - 1) / pixels_per_byte; }
+
+    /// @brief Set pixel value in packed buffer
+    static void setPixel(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel abs_x,
+        Pixel abs_y,
+        ColorType color
+    ) noexcept {
+        put(buffer + abs_y * rowSize(stride), abs_x, color);
+    }
+
+    /// @brief Fill rectangular region with specified value
+    /// @details Region is clipped horizontally to stride and vertically to zero once per call.
+    /// Whole bytes of each row are set with memset, odd edge pixels of 4-bit rows are merged.
+    static void fill(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        ColorType color
+    ) noexcept {
+        const auto x0 = kf::max<i32>(offset_x, 0);
+        const auto x1 = kf::min<i32>(offset_x + width, stride);
+        const auto y0 = kf::max<i32>(offset_y, 0);
+        const auto y1 = static_cast<i32>(offset_y + height);
+
+        if (x0 >= x1 or y0 >= y1) { return; }
+
+        const auto row_size = rowSize(stride);
+        BufferType *row = buffer + y0 * row_size;
+
+        if (x0 == 0 and x1 == stride and (Bits == 8 or stride % 2 == 0)) {
+            // Rows are contiguous and fully covered
+            std::memset(row, replicate(color), row_size * (y1 - y0));
+            return;
+        }
+
+        for (i32 y = y0; y < y1; y += 1, row += row_size) {
+            fillRow(row, x0, x1, color);
+        }
+    }
+
+    /// @brief Copy rectangular region from buffer of the same geometry (e.g. background layer)
+    /// @details Region is clipped like fill(). Whole bytes of each row are copied with memcpy,
+    /// odd edge pixels of 4-bit rows are merged.
+    /// @param buffer Destination buffer
+    /// @param source Source buffer with the same stride and row layout
+    static void copyRect(
+        BufferType *buffer,
+        const BufferType *source,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height
+    ) noexcept {
+        auto x0 = kf::max<i32>(offset_x, 0);
+        auto x1 = kf::min<i32>(offset_x + width, stride);
+        const auto y0 = kf::max<i32>(offset_y, 0);
+        const auto y1 = static_cast<i32>(offset_y + height);
+
+        if (x0 >= x1 or y0 >= y1) { return; }
+
+        const auto row_size = rowSize(stride);
+        BufferType *row = buffer + y0 * row_size;
+        const BufferType *source_row = source + y0 * row_size;
+
+        if (x0 == 0 and x1 == stride) {
+            // Rows are contiguous and fully covered (padding nibble copied along)
+            std::memcpy(row, source_row, row_size * (y1 - y0));
+            return;
+        }
+
+        const bool odd_left = Bits == 4 and (x0 & 1);
+        const bool odd_right = Bits == 4 and (x1 & 1);
+        const i32 left = odd_left ? x0 + 1 : x0;
+        const i32 right = odd_right ? x1 - 1 : x1;
+
+        for (i32 y = y0; y < y1; y += 1, row += row_size, source_row += row_size) {
+            if (odd_left) { put(row, x0, get(source_row, x0)); }
+            if (odd_right and x1 - 1 >= left) { put(row, x1 - 1, get(source_row, x1 - 1)); }
+
+            if (right > left) {
+                std::memcpy(row + left / pixels_per_byte, source_row + left / pixels_per_byte, static_cast<usize>(right - left) / pixels_per_byte);
+            }
+        }
+    }
+
+    /// @brief Move contents of region by (dx, dy) in place
+    /// @details Region is clipped like fill(). Rows are processed away from the move direction,
+    /// whole bytes are moved with memmove (single memmove when whole rows move vertically),
+    /// 4-bit rows moved by odd dx are shifted pixel by pixel. Pixels moved past region edges
+    /// are dropped, the uncovered strip keeps its previous contents.
+    static void scroll(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel dx,
+        Pixel dy
+    ) noexcept {
+        const auto x0 = kf::max<i32>(offset_x, 0);
+        const auto x1 = kf::min<i32>(offset_x + width, stride);
+        const auto y0 = kf::max<i32>(offset_y, 0);
+        const auto y1 = static_cast<i32>(offset_y + height);
+
+        // Destination part whose source lies inside region
+        const auto dest_x0 = kf::max<i32>(x0, x0 + dx);
+        const auto dest_x1 = kf::min<i32>(x1, x1 + dx);
+        const auto dest_y0 = kf::max<i32>(y0, y0 + dy);
+        const auto dest_y1 = kf::min<i32>(y1, y1 + dy);
+
+        if (dest_x0 >= dest_x1 or dest_y0 >= dest_y1) { return; }
+
+        const auto row_size = static_cast<isize>(rowSize(stride));
+        const auto rows = static_cast<usize>(dest_y1 - dest_y0);
+
+        if (dx == 0 and dest_x0 == 0 and dest_x1 == stride) {
+            // Rows are contiguous and fully covered (padding nibble moved along)
+            BufferType *start = buffer + dest_y0 * row_size;
+            std::memmove(start, start - dy * row_size, static_cast<usize>(row_size) * rows);
+            return;
+        }
+
+        // Sources lie above destination when moving down: walk rows bottom-up
+        const auto first_row = (dy > 0) ? dest_y1 - 1 : dest_y0;
+        const isize row_step = (dy > 0) ? -row_size : row_size;
+        BufferType *row = buffer + first_row * row_size;
+
+        for (usize i = 0; i < rows; i += 1, row += row_step) {
+            moveRow(row, row - dy * row_size, dest_x0, dest_x1, dx);
+        }
+    }
+
+    /// @brief Copy source image into destination window
+    /// @details Source uses the same row layout (rowSize(source_width) bytes per row).
+    /// Rows of equal nibble phase are combined byte-wise (memcpy for Copy),
+    /// rows of opposite phase are shifted pixel by pixel.
+    /// @param op Raster operation to combine source with destination
+    static void copy(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const BufferType *source,
+        Pixel source_width,
+        Pixel source_height,
+        RasterOp op = RasterOp::Copy
+    ) noexcept {
+        switch (op) {
+            case RasterOp::Copy:
+                blit<RasterOp::Copy>(buffer, stride, offset_x, offset_y, width, height, x, y, source, source_width, source_height);
+                return;
+            case RasterOp::Or:
+                blit<RasterOp::Or>(buffer, stride, offset_x, offset_y, width, height, x, y, source, source_width, source_height);
+                return;
+            case RasterOp::AndNot:
+                blit<RasterOp::AndNot>(buffer, stride, offset_x, offset_y, width, height, x, y, source, source_width, source_height);
+                return;
+            case RasterOp::Xor:
+                blit<RasterOp::Xor>(buffer, stride, offset_x, offset_y, width, height, x, y, source, source_width, source_height);
+                return;
+        }
+    }
+
+    /// @brief Draw 1-bit bitmap with color pair
+    /// @details Bitmap uses monochrome page layout (bit 0 of each column byte is the top pixel)
+    /// @param on Color of set bits
+    /// @param off Color of clear bits
+    static void bitmap(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const u8 *bitmap,
+        Pixel bitmap_width,
+        Pixel bitmap_height,
+        ColorType on,
+        ColorType off
+    ) noexcept {
+        forEachPixel(
+            buffer, stride, offset_x, offset_y, width, height, x, y, bitmap_width, bitmap_height,
+            [=](BufferType *row, i32 dest_x, i32 col, i32 source_row) {
+                put(row, dest_x, ((bitmap[(source_row / 8) * bitmap_width + col] >> (source_row % 8)) & 1) ? on : off);
+            });
+    }
+
+    /// @brief Draw set bits of 1-bit bitmap, clear bits are transparent
+    /// @param on Color of set bits
+    static void bitmapTransparent(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const u8 *bitmap,
+        Pixel bitmap_width,
+        Pixel bitmap_height,
+        ColorType on
+    ) noexcept {
+        forEachPixel(
+            buffer, stride, offset_x, offset_y, width, height, x, y, bitmap_width, bitmap_height,
+            [=](BufferType *row, i32 dest_x, i32 col, i32 source_row) {
+                if ((bitmap[(source_row / 8) * bitmap_width + col] >> (source_row % 8)) & 1) { put(row, dest_x, on); }
+            });
+    }
+
+    /// @brief Copy source image skipping pixels of key color
+    /// @param key Transparent color
+    static void copyKeyed(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const BufferType *source,
+        Pixel source_width,
+        Pixel source_height,
+        ColorType key
+    ) noexcept {
+        const auto source_row_size = rowSize(source_width);
+        forEachPixel(
+            buffer, stride, offset_x, offset_y, width, height, x, y, source_width, source_height,
+            [=](BufferType *row, i32 dest_x, i32 col, i32 source_row) {
+                const auto value = get(source + source_row * source_row_size, col);
+                if (value != key) { put(row, dest_x, value); }
+            });
+    }
+
+    /// @brief Copy source image through 1-bit alpha mask
+    /// @param mask Mask column bytes (monochrome page layout), set bits mark opaque pixels
+    static void copyMasked(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const BufferType *source,
+        Pixel source_width,
+        Pixel source_height,
+        const u8 *mask
+    ) noexcept {
+        const auto source_row_size = rowSize(source_width);
+        forEachPixel(
+            buffer, stride, offset_x, offset_y, width, height, x, y, source_width, source_height,
+            [=](BufferType *row, i32 dest_x, i32 col, i32 source_row) {
+                if ((mask[(source_row / 8) * source_width + col] >> (source_row % 8)) & 1) {
+                    put(row, dest_x, get(source + source_row * source_row_size, col));
+                }
+            });
+    }
+
+    /// @brief Expand row pixels into RGB565 colors through palette
+    /// @details 4-bit rows are expanded a byte (two pixels) per step
+    /// @param row Buffer row start
+    /// @param x First pixel of row to expand
+    /// @param count Pixels to expand
+    /// @param palette RGB565 color of each pixel value (palette_size entries)
+    /// @param out Destination colors
+    static void expandRow(const BufferType *row, Pixel x, usize count, const u16 *palette, u16 *out) noexcept {
+        if (Bits == 8) {
+            row += x;
+            for (usize i = 0; i < count; i += 1) {
+                out[i] = palette[row[i]];
+            }
+            return;
+        }
+
+        if (count > 0 and (x & 1)) {
+            *out++ = palette[get(row, x)];
+            x += 1;
+            count -= 1;
+        }
+
+        row += x / 2;
+        for (; count >= 2; count -= 2, row += 1, out += 2) {
+            out[0] = palette[*row >> 4];
+            out[1] = palette[*row & 0x0F];
+        }
+
+        if (count > 0) {
+            *out = palette[*row >> 4];
+        }
+    }
+
+    /// @brief Decode RLE-compressed image into fill and copy operations
+    /// @details Stream covers image pixels row by row, runs may cross rows.
+    /// Header byte: bit 7 set - run, next byte is value repeated (header & 0x7F) + 1 times,
+    /// bit 7 clear - header + 1 literal pixels follow, packed as in buffer rows
+    /// (left pixel in high nibble for 4-bit formats). Literals are copied from the stream
+    /// in place; a literal part starting mid-byte is emitted as single pixel fill.
+    /// @param fill Called as fill(x0, y0, x1, y1, color), inclusive bounds relative to image
+    /// @param copy Called as copy(x, y, pixels, width, height) for single row source
+    template<typename Fill, typename Copy> static void decode(
+        const BufferType *data, usize size,
+        Pixel image_width, Pixel image_height,
+        Fill &&fill, Copy &&copy
+    ) noexcept {
+        constexpr BufferType run_flag = 0x80;
+
+        const usize total = static_cast<usize>(image_width) * image_height;
+        usize position = 0;
+        usize i = 0;
+
+        while (i < size and position < total) {
+            const BufferType header = data[i];
+            i += 1;
+
+            const bool is_run = header & run_flag;
+            if (is_run and i >= size) { return; }
+
+            const usize declared = (header & ~run_flag) + 1u;
+
+            if (is_run) {
+                const auto color = static_cast<ColorType>(data[i] & ((1u << Bits) - 1));
+                i += 1;
+
+                for (usize count = kf::min(declared, total - position); count > 0;) {
+                    const auto row = static_cast<Pixel>(position / image_width);
+                    const auto column = static_cast<Pixel>(position % image_width);
+
+                    // Whole rows at once when aligned, otherwise up to end of row
+                    const auto full_rows = (column == 0) ? count / image_width : 0;
+                    const auto span = (full_rows > 0) ? full_rows * image_width : kf::min<usize>(count, image_width - column);
+                    const auto width = static_cast<Pixel>((full_rows > 0) ? image_width : span);
+                    const auto height = static_cast<Pixel>((full_rows > 0) ? full_rows : 1);
+
+                    fill(column, row, static_cast<Pixel>(column + width - 1), static_cast<Pixel>(row + height - 1), color);
+
+                    position += span;
+                    count -= span;
+                }
+                continue;
+            }
+
+            const auto bytes = kf::min(rowSize(declared), size - i);
+            const BufferType *literal = data + i;
+            i += bytes;
+
+            usize offset = 0;
+            for (usize count = kf::min(kf::min(declared, total - position), bytes * pixels_per_byte); count > 0;) {
+                const auto row = static_cast<Pixel>(position / image_width);
+                const auto column = static_cast<Pixel>(position % image_width);
+
+                usize span = 1;
+                if (offset % pixels_per_byte != 0) {
+                    fill(column, row, column, row, get(literal, static_cast<i32>(offset)));
+                } else {
+                    span = kf::min<usize>(count, image_width - column);
+                    copy(column, row, literal + offset / pixels_per_byte, static_cast<Pixel>(span), Pixel{1});
+                }
+
+                offset += span;
+                position += span;
+                count -= span;
+            }
+        }
+    }
+
+protected:
+    /// @brief Luma of RGB color (BT.601 weights)
+    static constexpr u8 luma(u8 r, u8 g, u8 b) noexcept {
+        return static_cast<u8>((r * 77u + g * 150u + b * 29u) >> 8);
+    }
+
+private:
+    /// @brief Move pixels [x0 - dx, x1 - dx) of source row to [x0, x1) of destination row (rows may be the same)
+    static void moveRow(BufferType *row, const BufferType *source_row, i32 x0, i32 x1, i32 dx) noexcept {
+        if (Bits == 4 and (dx & 1)) {
+            // Opposite nibble phase, walk away from the move direction
+            const auto count = x1 - x0;
+            for (i32 n = 0; n < count; n += 1) {
+                const auto x = (dx > 0) ? x1 - 1 - n : x0 + n;
+                put(row, x, get(source_row, x - dx));
+            }
+            return;
+        }
+
+        const bool odd_left = Bits == 4 and (x0 & 1);
+        const bool odd_right = Bits == 4 and (x1 & 1);
+        const i32 left = odd_left ? x0 + 1 : x0;
+        const i32 right = odd_right ? x1 - 1 : x1;
+
+        // Edge pixels are read before the middle bytes move over them
+        const auto left_pixel = odd_left ? get(source_row, x0 - dx) : ColorType{0};
+        const auto right_pixel = (odd_right and x1 - 1 >= left) ? get(source_row, x1 - 1 - dx) : ColorType{0};
+
+        if (right > left) {
+            std::memmove(row + left / pixels_per_byte, source_row + (left - dx) / pixels_per_byte, static_cast<usize>(right - left) / pixels_per_byte);
+        }
+
+        if (odd_left) { put(row, x0, left_pixel); }
+        if (odd_right and x1 - 1 >= left) { put(row, x1 - 1, right_pixel); }
+    }
+
+    /// @brief Read pixel value at X of row
+    static inline ColorType get(const BufferType *row, i32 x) noexcept {
+        if (Bits == 8) { return row[x]; }
+        return static_cast<ColorType>((x & 1) ? (row[x >> 1] & 0x0F) : (row[x >> 1] >> 4));
+    }
+
+    /// @brief Write pixel value at X of row
+    static inline void put(BufferType *row, i32 x, ColorType color) noexcept {
+        if (Bits == 8) {
+            row[x] = color;
+            return;
+        }
+
+        BufferType &byte = row[x >> 1];
+        byte = (x & 1)
+                   ? static_cast<u8>((byte & 0xF0) | (color & 0x0F))
+                   : static_cast<u8>((byte & 0x0F) | (color << 4));
+    }
+
+    /// @brief Pixel value replicated into every pixel of a byte
+    static constexpr u8 replicate(ColorType color) noexcept {
+        return (Bits == 8) ? color : static_cast<u8>((color & 0x0F) * 0x11);
+    }
+
+    /// @brief Set pixels [x0, x1) of row
+    static void fillRow(BufferType *row, i32 x0, i32 x1, ColorType color) noexcept {
+        if (Bits == 4) {
+            if (x0 & 1) {
+                put(row, x0, color);
+                x0 += 1;
+            }
+            if (x1 > x0 and (x1 & 1)) {
+                put(row, x1 - 1, color);
+                x1 -= 1;
+            }
+        }
+
+        if (x1 > x0) {
+            std::memset(row + x0 / pixels_per_byte, replicate(color), static_cast<usize>(x1 - x0) / pixels_per_byte);
+        }
+    }
+
+    /// @brief Combine source value with destination value
+    template<RasterOp Op> static inline u8 combine(u8 dest, u8 source) noexcept {
+        switch (Op) {
+            case RasterOp::Copy:
+                return source;
+            case RasterOp::Or:
+                return static_cast<u8>(dest | source);
+            case RasterOp::AndNot:
+                return static_cast<u8>(dest & ~source);
+            case RasterOp::Xor:
+                return static_cast<u8>(dest ^ source);
+        }
+        return dest;
+    }
+
+    /// @brief Row blitter backend for specific raster operation
+    template<RasterOp Op> static void blit(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        const BufferType *source,
+        Pixel source_width,
+        Pixel source_height
+    ) noexcept {
+        const auto col_begin = kf::max<i32>(x, 0);
+        const auto col_end = kf::min<i32>(x + source_width, width);
+        const auto row_begin = kf::max<i32>(y, 0);
+        const auto row_end = kf::min<i32>(y + source_height, height);
+
+        if (col_begin >= col_end or row_begin >= row_end) { return; }
+
+        const auto row_size = rowSize(stride);
+        const auto source_row_size = rowSize(source_width);
+        const auto count = col_end - col_begin;
+
+        // First pixel of each row in source and destination
+        const i32 source_x0 = col_begin - x;
+        const i32 dest_x0 = offset_x + col_begin;
+
+        const BufferType *source_row = source + (row_begin - y) * source_row_size;
+        BufferType *dest_row = buffer + (offset_y + row_begin) * row_size;
+
+        for (i32 row = row_begin; row < row_end; row += 1, source_row += source_row_size, dest_row += row_size) {
+            i32 sx = source_x0;
+            i32 dx = dest_x0;
+            i32 remaining = count;
+
+            if (Bits == 4 and ((sx ^ dx) & 1)) {
+                // Opposite nibble phase: shift pixel by pixel
+                for (; remaining > 0; remaining -= 1, sx += 1, dx += 1) {
+                    put(dest_row, dx, combine<Op>(get(dest_row, dx), get(source_row, sx)));
+                }
+                continue;
+            }
+
+            if (Bits == 4 and (dx & 1)) {
+                put(dest_row, dx, combine<Op>(get(dest_row, dx), get(source_row, sx)));
+                sx += 1;
+                dx += 1;
+                remaining -= 1;
+            }
+
+            const auto bytes = static_cast<usize>(remaining / pixels_per_byte);
+            const BufferType *s = source_row + sx / pixels_per_byte;
+            BufferType *d = dest_row + dx / pixels_per_byte;
+
+            if (Op == RasterOp::Copy) {
+                std::memcpy(d, s, bytes);
+            } else {
+                for (usize i = 0; i < bytes; i += 1) {
+                    d[i] = combine<Op>(d[i], s[i]);
+                }
+            }
+
+            const auto done = static_cast<i32>(bytes * pixels_per_byte);
+            if (remaining > done) {
+                put(dest_row, dx + done, combine<Op>(get(dest_row, dx + done), get(source_row, sx + done)));
+            }
+        }
+    }
+
+    /// @brief Visit destination pixels covered by clipped source rectangle
+    /// @param visit Called as visit(dest_row, dest_x, source_col, source_row), dest_x is absolute
+    template<typename Visit> static void forEachPixel(
+        BufferType *buffer,
+        Pixel stride,
+        Pixel offset_x,
+        Pixel offset_y,
+        Pixel width,
+        Pixel height,
+        Pixel x,
+        Pixel y,
+        Pixel source_width,
+        Pixel source_height,
+        Visit &&visit
+    ) noexcept {
+        const auto col_begin = kf::max<i32>(x, 0);
+        const auto col_end = kf::min<i32>(x + source_width, width);
+        const auto row_begin = kf::max<i32>(y, 0);
+        const auto row_end = kf::min<i32>(y + source_height, height);
+
+        if (col_begin >= col_end or row_begin >= row_end) { return; }
+
+        const auto row_size = rowSize(stride);
+        BufferType *dest_row = buffer + (offset_y + row_begin) * row_size;
+
+        for (i32 row = row_begin; row < row_end; row += 1, dest_row += row_size) {
+            for (i32 col = col_begin; col < col_end; col += 1) {
+                visit(dest_row, offset_x + col, col - x, row - y);
+            }
+        }
+    }
+};
+
+/// @brief 4-bit grayscale pixel format traits (SSD1327/SSD1322-class panels)
+/// @details Value 0 is black, 15 is white
+template<> struct pixel_traits<PixelFormat::Gray4> : packed_pixel_traits<4> {
+    static constexpr ColorType fromRgb(u8 r, u8 g, u8 b) noexcept {
+        return static_cast<ColorType>(luma(r, g, b) >> 4);
+    }
+
+    /// @brief RGB565 color shown for pixel value
+    static constexpr u16 toRgb565(ColorType level) noexcept {
+        const auto v = static_cast<u8>((level & 0x0F) * 17);
+        return pixel_traits<PixelFormat::RGB565>::fromRgb(v, v, v);
+    }
+};
+
+/// @brief RGB332 pixel format traits (8 bits per pixel)
+template<> struct pixel_traits<PixelFormat::RGB332> : packed_pixel_traits<8> {
+    static constexpr ColorType fromRgb(u8 r, u8 g, u8 b) noexcept {
+        return static_cast<ColorType>((r & 0xE0) | ((g & 0xE0) >> 3) | (b >> 6));
+    }
+
+    /// @brief RGB565 color shown for pixel value
+    static constexpr u16 toRgb565(ColorType color) noexcept {
+        const auto r = static_cast<u8>((color >> 5) * 255 / 7);
+        const auto g = static_cast<u8>(((color >> 2) & 0x07) * 255 / 7);
+        const auto b = static_cast<u8>((color & 0x03) * 85);
+        return pixel_traits<PixelFormat::RGB565>::fromRgb(r, g, b);
+    }
+};
+
+/// @brief RGB components of the 16 ANSI colors, in ColorPalette::Ansi order
+/// @details Single source of ANSI colors: ColorPalette converts them into every pixel format,
+/// Indexed4 uses them as its default palette (so ANSI colors map to indices 0..15)
+inline constexpr u8 ansi_rgb[16][3]{
+    {0x00, 0x00, 0x00},// black
+    {0x80, 0x00, 0x00},// red
+    {0x00, 0x80, 0x00},// green
+    {0x80, 0x80, 0x00},// yellow
+    {0x00, 0x00, 0x80},// blue
+    {0x80, 0x00, 0x80},// purple
+    {0x00, 0x60, 0x60},// cyan
+    {0x80, 0x80, 0x80},// white
+    {0x30, 0x30, 0x30},// bright black
+    {0xFF, 0x20, 0x20},// bright red
+    {0x20, 0xCF, 0x20},// bright green
+    {0xFF, 0xFF, 0x00},// bright yellow
+    {0x20, 0x20, 0xFF},// bright blue
+    {0xFF, 0x20, 0xFF},// bright purple
+    {0x00, 0xDF, 0xCF},// bright cyan
+    {0xFF, 0xFF, 0xFF},// bright white
+};
+
+/// @brief 4-bit indexed pixel format traits
+/// @details Pixel value is palette index. Default palette is ansi_rgb,
+/// so fromRgb (nearest default color) maps ANSI colors of ColorPalette to their indices.
+/// Drivers keep the palette at runtime and expand it while sending.
+template<> struct pixel_traits<PixelFormat::Indexed4> : packed_pixel_traits<4> {
+    /// @brief Default palette colors (R, G, B)
+    static constexpr const auto &default_palette = ansi_rgb;
+
+    /// @brief Index of nearest default palette color
+    static constexpr ColorType fromRgb(u8 r, u8 g, u8 b) noexcept {
+        ColorType best = 0;
+        u32 best_distance = ~u32{0};
+
+        for (u8 i = 0; i < 16; i += 1) {
+            const i32 dr = r - default_palette[i][0];
+            const i32 dg = g - default_palette[i][1];
+            const i32 db = b - default_palette[i][2];
+            const auto distance = static_cast<u32>(dr * dr + dg * dg + db * db);
+
+            if (distance < best_distance) {
+                best = i;
+                best_distance = distance;
+            }
+        }
+
+        return best;
+    }
+
+    /// @brief RGB565 color of default palette entry
+    static constexpr u16 toRgb565(ColorType index) noexcept {
+        const auto &rgb = default_palette[index & 0x0F];
+        return pixel_traits<PixelFormat::RGB565>::fromRgb(rgb[0], rgb[1], rgb[2]);
+    }
+};
+
+/// @brief 8-bit indexed pixel format traits
+/// @details Pixel value is palette index. Default palette is RGB332, so fromRgb
+/// is RGB332 quantization until the application loads its own palette into the driver.
+template<> struct pixel_traits<PixelFormat::Indexed8> : packed_pixel_traits<8> {
+    static constexpr ColorType fromRgb(u8 r, u8 g, u8 b) noexcept {
+        return pixel_traits<PixelFormat::RGB332>::fromRgb(r, g, b);
+    }
+
+    /// @brief RGB565 color of default palette entry
+    static constexpr u16 toRgb565(ColorType index) noexcept {
+        return pixel_traits<PixelFormat::RGB332>::toRgb565(index);
+    }
 };
 
 }// namespace kf
@@ -3,8 +3,14 @@
 
 #pragma once
 
+#include <kf/Option.hpp>
 #include <kf/core/attributes.hpp>
 #include <kf/core/pixel_traits.hpp>
+#include <kf/gfx/Canvas.hpp>
+#include <kf/gfx/DirtyRegion.hpp>
+#include <kf/gfx/DisplayList.hpp>
+#include <kf/gfx/DynamicImage.hpp>
+#include <kf/gfx/StaticFrame.hpp>
 #include <kf/memory/Slice.hpp>
 
 
@@ -15,7 +21,11 @@ namespace kf {
 /// @tparam F Physical display pixel format
 /// @tparam W Physical display width in pixels
 /// @tparam H Physical display height in pixels
-template<typename Impl, PixelFormat F, usize W, usize H> struct DisplayDriver {
+/// @tparam R Rows held by software buffer: H for a full frame buffer,
+/// fewer for band mode (frames are drawn with render() one band of R rows at a time)
+template<typename Impl, PixelFormat F, usize W, usize H, usize R = H> struct DisplayDriver {
+    static_assert(R >= 1 and R <= H, "R must be in [1, H]");
+
     friend Impl;
 
 protected:
@@ -32,6 +42,12 @@ public:
     /// @brief Pixel format
     static constexpr auto pixel_format{F};
 
+    /// @brief Canvas bound to physical display size (see staticFrame())
+    using StaticCanvas = gfx::StaticCanvas<F, static_cast<Pixel>(W), static_cast<Pixel>(H)>;
+
+    /// @brief Canvas bound to display size in 90 degree orientations (see staticFrame<true>())
+    using RotatedStaticCanvas = gfx::StaticCanvas<F, static_cast<Pixel>(H), static_cast<Pixel>(W)>;
+
 protected:
     /// @brief Physical display width
     static constexpr auto phys_width{W};
@@ -45,12 +61,18 @@ protected:
     /// @brief Maximum physical Y coordinate
     static constexpr auto max_phys_y{phys_height - 1};
 
+    /// @brief Software buffer holds whole frame (band mode otherwise)
+    static constexpr bool is_full_frame{R == H};
+
     /// @brief Required buffer size for the display
-    static constexpr auto buffer_items{traits::template buffer_size<W, H>};
+    static constexpr auto buffer_items{traits::template buffer_size<W, R>};
 
-    /// @brief Software frame buffer for display operations
+    /// @brief Software frame buffer (or band strip buffer) for display operations
     BufferType software_screen_buffer[buffer_items]{};
 
+    /// @brief Buffer area modified since last transfer (whole screen until first send)
+    gfx::DirtyRegion dirty_region{gfx::DirtyRegion::full(W, H)};
+
 public:
     /// @brief Display orientation modes
     enum class Orientation : u8 {
@@ -71,21 +93,118 @@ public:
     /// @brief Get current display height in pixels (may differ from physical width due to orientation)
     kf_nodiscard u8 height() const noexcept { return c_impl().getHeightImpl(); }
 
-    /// @brief Transfer software buffer to display hardware
-    void send() const noexcept { c_impl().sendImpl(); }
+    /// @brief Transfer whole software buffer to display hardware
+    /// @details Modified area is left as is, use the non-const overload to reset it
+    void send() const noexcept {
+        static_assert(is_full_frame, "Band mode driver has no frame buffer, use render()");
+        c_impl().sendImpl(gfx::DirtyRegion::full(width(), height()));
+    }
+
+    /// @brief Transfer whole software buffer to display hardware and clear modified area
+    void send() noexcept {
+        static_cast<const DisplayDriver &>(*this).send();
+        dirty_region.clear();
+    }
+
+    /// @brief Transfer only modified buffer area to display hardware
+    /// @note Writes made through buffer() bypass tracking, call invalidate() after them
+    void sendDirty() noexcept {
+        static_assert(is_full_frame, "Band mode driver has no frame buffer, use render()");
+
+        dirty_region.clip(width(), height());
+        if (dirty_region.isEmpty()) { return; }
+
+        c_impl().sendImpl(dirty_region);
+        dirty_region.clear();
+    }
+
+    /// @brief Mark whole screen as modified
+    void invalidate() noexcept { dirty_region = gfx::DirtyRegion::full(width(), height()); }
+
+    /// @brief Get buffer area modified since last transfer
+    kf_nodiscard gfx::DirtyRegion &dirtyRegion() noexcept { return dirty_region; }
+
+    /// @brief Rasterize display list and transfer it to display hardware
+    /// @details Full frame buffer: list is replayed into the buffer, modified area is sent.
+    /// Band mode: list is replayed once per band of buffer rows (clipped to the band),
+    /// each band is sent to its own display window and the strip buffer is reused.
+    /// @note In band mode strip keeps pixels of previous band, lists should start with fill()
+    void render(const gfx::DisplayList<F> &list) noexcept {
+        if constexpr (is_full_frame) {
+            gfx::Canvas<F> canvas{image()};
+            list.replay(canvas);
+            sendDirty();
+        } else {
+            const auto rows = bandRows();
+
+            for (Pixel top = 0; top < height(); top += rows) {
+                const auto bottom = static_cast<Pixel>(kf::min<Pixel>(static_cast<Pixel>(top + rows), height()) - 1);
+
+                // Full screen coordinates, band rows map to strip start
+                gfx::Canvas<F> canvas{gfx::DynamicImage<F>{
+                    software_screen_buffer, width(),
+                    width(), height(),
+                    0, static_cast<Pixel>(-top)}};
+
+                if (canvas.pushClip(0, top, maxX(), bottom)) {
+                    list.replay(canvas);
+                }
+
+                c_impl().sendBandImpl(gfx::DirtyRegion{0, top, maxX(), bottom});
+            }
+        }
+    }
 
     /// @brief Set display orientation
-    void setOrientation(Orientation orientation) noexcept { impl().setOrientationImpl(orientation); }
+    void setOrientation(Orientation orientation) noexcept {
+        impl().setOrientationImpl(orientation);
+        invalidate();
+    }
 
     /// @brief Get writable software frame buffer
     kf_nodiscard Slice<BufferType> buffer() noexcept { return {software_screen_buffer, buffer_items}; }
 
+    /// @brief Get full screen image view feeding dirty region tracking
+    kf_nodiscard gfx::DynamicImage<F> image() noexcept {
+        static_assert(is_full_frame, "Band mode driver has no frame buffer, use render()");
+        return gfx::DynamicImage<F>{software_screen_buffer, width(), width(), height(), 0, 0, &dirty_region};
+    }
+
+    /// @brief Get full screen view of size fixed at compile time, feeding dirty region tracking
+    /// @tparam Rotated false - physical W x H frame (Normal, MirrorX, MirrorY, Flip),
+    /// true - H x W frame (ClockWise, CounterClockWise)
+    /// @details Drawing through StaticCanvas (RotatedStaticCanvas) folds view address math into constants
+    /// @return Frame, or nothing if current orientation has other geometry
+    template<bool Rotated = false> kf_nodiscard Option<gfx::StaticFrame<
+        F,
+        static_cast<Pixel>(Rotated ? H : W),
+        static_cast<Pixel>(Rotated ? W : H)>> staticFrame() noexcept {
+        static_assert(is_full_frame, "Band mode driver has no frame buffer, use render()");
+
+        using Frame = gfx::StaticFrame<F, static_cast<Pixel>(Rotated ? H : W), static_cast<Pixel>(Rotated ? W : H)>;
+        static_assert(Frame::buffer_items <= buffer_items, "Rotated frame does not fit display buffer");
+
+        if (width() != Frame::width or height() != Frame::height) { return {}; }
+        return Frame{software_screen_buffer, &dirty_region};
+    }
+
     /// @brief Get maximum valid X coordinate for current orientation
     kf_nodiscard u8 maxX() const noexcept { return width() - 1; }
 
     /// @brief Get maximum valid Y coordinate for current orientation
     kf_nodiscard u8 maxY() const noexcept { return height() - 1; }
 
+    /// @brief Rows per band for current orientation (whole pages for page layouts)
+    /// @details Rows held by software buffer: whole screen height or more for full frame drivers
+    kf_nodiscard Pixel bandRows() const noexcept {
+        constexpr auto page_rows{8 / traits::template buffer_size<1, 8>};
+        constexpr auto item_bits{8 * sizeof(BufferType)};
+
+        // Buffer items holding page_rows rows of current width (rows start on item boundary)
+        const auto group_items{(width() * page_rows * traits::bits_per_pixel + item_bits - 1) / item_bits};
+        return static_cast<Pixel>(buffer_items / group_items * page_rows);
+    }
+
 private:
     inline Impl &impl() noexcept{ return *static_cast<Impl *>(this); }
 
@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include <cstring>
+
 #include <Wire.h>
 
+#include "kf/algorithm.hpp"
 #include "kf/aliases.hpp"
 #include "kf/core/pixel_traits.hpp"
 #include "kf/drivers/display/DisplayDriver.hpp"
@@ -24,15 +27,60 @@ struct SSD1306 : DisplayDriver<SSD1306, PixelFormat::Monochrome, 128, 64> {
             i2c_clock_frequency{clock_frequency}, address{address} {}
     };
 
+    /// @brief Copy of last transmitted frame for change-only transfers
+    /// @details When attached, each send compares the buffer page by page against this copy
+    /// and transmits only changed column runs. Nearby runs are merged so addressing overhead
+    /// does not exceed the bytes saved.
+    struct ShadowBuffer {
+        /// @brief Transfer statistics of the last send
+        struct Stats {
+            usize bytes_sent{0}; ///< Frame bytes transmitted
+            usize bytes_saved{0};///< Frame bytes skipped as unchanged
+            u16 runs{0};         ///< Address windows (runs) transmitted
+        };
+
+        u8 frame[buffer_items]{};///< Display RAM contents as of last transfer
+        Stats stats{};           ///< Statistics of the last transfer
+        bool valid{false};       ///< Frame matches display RAM (false until first full transfer)
+    };
+
 private:
+    /// @brief Runs separated by at most this many unchanged bytes are merged
+    /// @details Starting a run costs a ColumnAddr/PageAddr transaction and a data transaction header
+    static constexpr usize run_merge_gap = 10;
+
+    static constexpr auto packet_size = 64;// Optimal for ESP32 performance
+
+    /// @brief Number of display RAM pages
+    static constexpr u8 page_count = traits::template pages<phys_height>;
+
+    /// @brief Software rotation applied while sending
+    enum class Rotation : u8 {
+        None,            ///< Buffer has physical layout
+        ClockWise,       ///< Buffer is portrait frame rotated 90 degrees clockwise onto panel
+        CounterClockWise,///< Buffer is portrait frame rotated 90 degrees counterclockwise onto panel
+    };
+
     const Config &config;
     TwoWire &wire;
+    ShadowBuffer *shadow{nullptr};
+    Rotation rotation{Rotation::None};
+    u8 start_page{0};///< Display RAM page shown as frame page 0 (hardware scroll)
 
 public:
     /// @brief Construct SSD1306 driver instance
     explicit SSD1306(const Config &config, TwoWire &wire) noexcept:
         config{config}, wire{wire} {}
 
+    /// @brief Enable change-only transfers through shadow buffer
+    /// @param shadow_buffer Shadow buffer (must outlive driver) or nullptr to disable
+    void setShadowBuffer(ShadowBuffer *shadow_buffer) noexcept {
+        shadow = shadow_buffer;
+        if (nullptr != shadow) {
+            shadow->valid = false;
+        }
+    }
+
     /// @brief Set display contrast level (0..255)
     void setContrast(u8 value) const {
         wire.beginTransmission(config.address);
@@ -52,17 +100,57 @@ public:
         sendCommand(invert ? InvertDisplay : NormalDisplay);
     }
 
+    /// @brief Move frame contents vertically by dy rows, filling uncovered rows with value
+    /// @details Whole pages (dy multiple of 8) without 90 degree rotation move the display start line:
+    /// display RAM is not rewritten, only the uncovered pages are marked dirty for next sendDirty().
+    /// Other moves are done in software buffer and mark the whole frame dirty.
+    /// @note Until next sendDirty() uncovered rows show the pages scrolled out on the opposite edge
+    void scroll(Pixel dy, bool value = false) noexcept {
+        const auto frame_height = static_cast<Pixel>(height());
+        if (dy == 0) { return; }
+
+        if (dy <= -frame_height or dy >= frame_height) {
+            image().fill(value);
+            return;
+        }
+
+        if (not isRotated() and dy % traits::page_height == 0) {
+            // Display RAM keeps moved pages, pending changes move along with the buffer
+            traits::scroll(software_screen_buffer, width(), 0, 0, width(), frame_height, 0, dy);
+
+            if (not dirty_region.isEmpty()) {
+                dirty_region.top = static_cast<Pixel>(dirty_region.top + dy);
+                dirty_region.bottom = static_cast<Pixel>(dirty_region.bottom + dy);
+                dirty_region.clip(width(), frame_height);
+            }
+
+            setStartPage(static_cast<u8>((start_page + page_count - dy / traits::page_height) % page_count));
+        } else {
+            image().scroll(0, dy);
+        }
+
+        const auto frame = image();
+        if (dy > 0) {
+            frame.fill(0, 0, maxX(), static_cast<Pixel>(dy - 1), value);
+        } else {
+            frame.fill(0, static_cast<Pixel>(frame_height + dy), maxX(), maxY(), value);
+        }
+    }
+
 private:
     // DisplayDriver interface implementation
 
-    /// @brief Get physical display width
-    kf_nodiscard static u8 getWidthImpl() noexcept { return phys_width; }
+    /// @brief Get logical display width (physical height when rotated)
+    kf_nodiscard u8 getWidthImpl() const noexcept { return isRotated() ? phys_height : phys_width; }
+
+    /// @brief Get logical display height (physical width when rotated)
+    kf_nodiscard u8 getHeightImpl() const noexcept { return isRotated() ? phys_width : phys_height; }
 
-    /// @brief Get physical display height
-    kf_nodiscard static u8 getHeightImpl() noexcept { return phys_height; }
+    /// @brief Check if buffer holds rotated (portrait) frame
+    kf_nodiscard bool isRotated() const noexcept { return rotation != Rotation::None; }
 
     /// @brief Initialize display hardware via I2C
-    kf_nodiscard bool initImpl() const noexcept {
+    kf_nodiscard bool initImpl() noexcept {
         static constexpr u8 init_commands[] = {
             CommandMode,
 
@@ -78,6 +166,9 @@ private:
             // Horizontal addressing mode
             AddressingMode, Horizontal,
 
+            // Display RAM row 0 on top
+            SetStartLine,
+
             // Default contrast 127
             Contrast, 0x7F,
 
@@ -97,6 +188,13 @@ private:
             SetMultiplex, 0x3F
         };
 
+        if (nullptr != shadow) {
+            // Display RAM is undefined after power-up
+            shadow->valid = false;
+        }
+
+        start_page = 0;
+
         if (not wire.begin()) { return false; }
 
         if (not wire.setClock(config.i2c_clock_frequency)) { return false; }
@@ -110,44 +208,242 @@ private:
         return 0 == end_transmission_code;
     }
 
-    /// @brief Transfer software buffer to display via I2C
-    void sendImpl() const noexcept {
-        static constexpr auto packet_size = 64;// Optimal for ESP32 performance
+    /// @brief Transfer region of software buffer to display via I2C
+    /// @details Without shadow buffer the whole region window is streamed,
+    /// otherwise only bytes differing from the shadow frame are transmitted
+    void sendImpl(const gfx::DirtyRegion &logical_region) const noexcept {
+        const auto region = physicalRegion(logical_region);
+        const auto first_page = static_cast<u8>(region.top / traits::page_height);
+        const auto last_page = static_cast<u8>(region.bottom / traits::page_height);
+
+        if (nullptr == shadow) {
+            sendWindow(static_cast<u8>(region.left), static_cast<u8>(region.right), first_page, last_page);
+            return;
+        }
+
+        auto &stats = shadow->stats;
+        stats = {};
+
+        if (not shadow->valid) {
+            // Display RAM contents unknown: transfer everything once
+            sendWindow(0, max_phys_x, 0, traits::template pages<phys_height> - 1);
+            shadow->valid = true;
+            stats.bytes_sent = sizeof(software_screen_buffer);
+            stats.runs = 1;
+            return;
+        }
+
+        for (auto page = first_page; page <= last_page; page += 1) {
+            sendPageChanges(page, region.left, region.right, stats);
+        }
+
+        const auto region_bytes = static_cast<usize>(region.width()) * (last_page - first_page + 1);
+        stats.bytes_saved = region_bytes - stats.bytes_sent;
+    }
+
+    /// @brief Map region of logical frame to physical panel region
+    kf_nodiscard gfx::DirtyRegion physicalRegion(const gfx::DirtyRegion &region) const noexcept {
+        switch (rotation) {
+            case Rotation::ClockWise: {
+                // Logical (x, y) is shown at physical (max_phys_x - y, x)
+                return {
+                    static_cast<Pixel>(max_phys_x - region.bottom), region.left,
+                    static_cast<Pixel>(max_phys_x - region.top), region.right};
+            }
+            case Rotation::CounterClockWise: {
+                // Logical (x, y) is shown at physical (y, max_phys_y - x)
+                return {
+                    region.top, static_cast<Pixel>(max_phys_y - region.right),
+                    region.bottom, static_cast<Pixel>(max_phys_y - region.left)};
+            }
+            case Rotation::None: {
+                break;
+            }
+        }
+        return region;
+    }
+
+    /// @brief Get physical page columns [left, right]
+    /// @details Without rotation points into software buffer, otherwise 8x8 blocks
+    /// of the rotated frame are transposed into scratch (covering whole blocks around the range)
+    /// @param scratch Buffer of phys_width bytes for rotated page
+    /// @return Page bytes indexed by physical column
+    const u8 *physicalPage(u8 page, Pixel left, Pixel right, u8 *scratch) const noexcept {
+        if (not isRotated()) {
+            return software_screen_buffer + page * phys_width;
+        }
+
+        constexpr auto block = traits::page_height;
+        const auto logical_width = getWidthImpl();
+
+        for (auto column = static_cast<Pixel>(left & ~(block - 1)); column <= right; column += block) {
+            if (rotation == Rotation::ClockWise) {
+                // Physical columns of block come from one logical page, rows in reverse
+                const auto logical_page = (max_phys_x - (column + block - 1)) / block;
+                traits::transpose(
+                    software_screen_buffer + logical_page * logical_width + page * block, 1,
+                    scratch + column + block - 1, -1);
+            } else {
+                // Logical columns are read right to left
+                const auto logical_page = column / block;
+                traits::transpose(
+                    software_screen_buffer + logical_page * logical_width + (max_phys_y - page * block), -1,
+                    scratch + column, 1);
+            }
+        }
+
+        return scratch;
+    }
+
+    /// @brief Transmit changed runs of page columns [left, right] and update shadow frame
+    void sendPageChanges(u8 page, Pixel left, Pixel right, typename ShadowBuffer::Stats &stats) const noexcept {
+        u8 scratch[phys_width];
+        const u8 *current = physicalPage(page, left, right, scratch);
+        u8 *previous = shadow->frame + ramPage(page) * phys_width;
+
+        i32 run_begin = -1;
+        i32 run_end = -1;
+
+        for (i32 chunk = left; chunk <= right; chunk += packet_size) {
+            const auto chunk_end = kf::min<i32>(chunk + packet_size, right + 1);
+
+            // Fast skip of unchanged packets
+            if (0 == std::memcmp(current + chunk, previous + chunk, chunk_end - chunk)) { continue; }
+
+            for (auto column = chunk; column < chunk_end; column += 1) {
+                if (current[column] == previous[column]) { continue; }
 
-        static constexpr u8 set_area_commands[] = {
+                if (run_begin >= 0 and static_cast<usize>(column - run_end) <= run_merge_gap + 1) {
+                    run_end = column;
+                    continue;
+                }
+
+                if (run_begin >= 0) {
+                    sendRun(page, run_begin, run_end, current, stats);
+                }
+
+                run_begin = column;
+                run_end = column;
+            }
+        }
+
+        if (run_begin >= 0) {
+            sendRun(page, run_begin, run_end, current, stats);
+        }
+    }
+
+    /// @brief Transmit single page run [begin, end] and remember it in shadow frame
+    /// @param current Page bytes indexed by physical column
+    void sendRun(u8 page, i32 begin, i32 end, const u8 *current, typename ShadowBuffer::Stats &stats) const noexcept {
+        const auto count = static_cast<usize>(end - begin + 1);
+
+        setWindow(static_cast<u8>(begin), static_cast<u8>(end), page, page);
+        streamColumns(current + begin, count);
+        std::memcpy(shadow->frame + ramPage(page) * phys_width + begin, current + begin, count);
+
+        stats.bytes_sent += count;
+        stats.runs += 1;
+    }
+
+    /// @brief Set column/page address window and stream its contents
+    /// @details Streamed pages are also stored into shadow frame when it is attached.
+    /// Pages wrapping past the end of display RAM (after hardware scroll) are sent as two windows.
+    void sendWindow(u8 left, u8 right, u8 first_page, u8 last_page) const noexcept {
+        const auto wrap_page = static_cast<u8>(page_count - start_page);// First page stored at RAM page 0
+
+        if (first_page < wrap_page and last_page >= wrap_page) {
+            sendWindow(left, right, first_page, static_cast<u8>(wrap_page - 1));
+            sendWindow(left, right, wrap_page, last_page);
+            return;
+        }
+
+        setWindow(left, right, first_page, last_page);
+
+        const auto columns = static_cast<usize>(right - left + 1);
+        u8 scratch[phys_width];
+
+        for (auto page = first_page; page <= last_page; page += 1) {
+            const u8 *current = physicalPage(page, left, right, scratch);
+            streamColumns(current + left, columns);
+
+            if (nullptr != shadow) {
+                std::memcpy(shadow->frame + ramPage(page) * phys_width + left, current + left, columns);
+            }
+        }
+    }
+
+    /// @brief Set column/page address window
+    /// @param first_page First frame page (window must not wrap in display RAM)
+    /// @param last_page Last frame page
+    void setWindow(u8 left, u8 right, u8 first_page, u8 last_page) const noexcept {
+        const u8 set_area_commands[] = {
             CommandMode,
-            // Set full display window
             ColumnAddr,
-            0,
-            max_phys_x,
+            left,
+            right,
             PageAddr,
-            0,
-            traits::template pages<phys_height> - 1,
+            ramPage(first_page),
+            ramPage(last_page),
         };
 
         wire.beginTransmission(config.address);
         (void) wire.write(set_area_commands, sizeof(set_area_commands));
         (void) wire.endTransmission();
+    }
+
+    /// @brief Display RAM page holding frame page
+    kf_nodiscard u8 ramPage(u8 page) const noexcept { return static_cast<u8>((page + start_page) % page_count); }
 
-        auto p = software_screen_buffer;
-        const auto *end = p + sizeof(software_screen_buffer);
+    /// @brief Show display RAM page as frame page 0
+    void setStartPage(u8 page) noexcept {
+        start_page = page;
+        sendCommand(static_cast<Command>(SetStartLine | (page * traits::page_height)));
+    }
+
+    /// @brief Stream bytes into current address window
+    void streamColumns(const u8 *p, usize count) const noexcept {
+        const auto *end = p + count;
 
         while (p < end) {
+            const auto chunk = kf::min<usize>(packet_size, end - p);
+
             wire.beginTransmission(config.address);
             (void) wire.write(Command::DataMode);
-            (void) wire.write(p, packet_size);
+            (void) wire.write(p, chunk);
             (void) wire.endTransmission();
 
-            p += packet_size;
+            p += chunk;
         }
     }
 
-    /// @brief Apply orientation transformation (only flip operations supported)
+    /// @brief Apply orientation transformation
+    /// @details Flips use segment/COM remap, 90/270 degree rotations are done in software:
+    /// buffer holds portrait frame which is transposed by 8x8 blocks while sending
     void setOrientationImpl(Orientation orientation) noexcept {
         constexpr auto flip_x = 0b01;
         constexpr auto flip_y = 0b10;
 
-        const u8 flags = static_cast<u8>(orientation) & (flip_x | flip_y);
+        switch (orientation) {
+            case Orientation::ClockWise: {
+                rotation = Rotation::ClockWise;
+                break;
+            }
+            case Orientation::CounterClockWise: {
+                rotation = Rotation::CounterClockWise;
+                break;
+            }
+            default: {
+                rotation = Rotation::None;
+                break;
+            }
+        }
+
+        if (isRotated() and start_page != 0) {
+            // Rotated frames are sent with identity page mapping
+            setStartPage(0);
+        }
+
+        const u8 flags = isRotated() ? 0 : static_cast<u8>(orientation) & (flip_x | flip_y);
         sendCommand((flags & flip_x) ? FlipH : NormalH);
         sendCommand((flags & flip_y) ? FlipV : NormalV);
     }
@@ -178,6 +474,7 @@ private:
         ColumnAddr = 0x21,   ///< Set column address range
         PageAddr = 0x22,     ///< Set page address range
         ChargePump = 0x8D,   ///< Charge pump setting
+        SetStartLine = 0x40, ///< Set display start line (RAM row in low 6 bits)
 
         NormalDisplay = 0xA6,///< Normal pixel color (black on white)
         InvertDisplay = 0xA7 ///< Inverted pixel color (white on black)
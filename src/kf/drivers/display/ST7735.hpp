@@ -14,9 +14,31 @@
 namespace kf {
 
 /// @brief ST7735 TFT display driver for 128x160 RGB565 panels
-struct ST7735 : DisplayDriver<ST7735, PixelFormat::RGB565, 128, 160> {
+/// @tparam R Rows held by software buffer: 160 for a full frame buffer (40 KiB),
+/// fewer for band mode where frames are drawn with render() through an R-row strip
+/// @tparam F Software buffer pixel format: RGB565 is sent as is, packed formats
+/// (Gray4, RGB332, Indexed4, Indexed8) are expanded through a palette while sending
+/// (Indexed4 full frame buffer takes 10 KiB)
+template<usize R, PixelFormat F = PixelFormat::RGB565> struct BasicST7735 : DisplayDriver<BasicST7735<R, F>, F, 128, 160, R> {
+
+private:
+    using Base = DisplayDriver<BasicST7735<R, F>, F, 128, 160, R>;
     friend Base;
 
+public:
+    using typename Base::BufferType;
+    using typename Base::ColorType;
+    using typename Base::Orientation;
+
+private:
+    using typename Base::traits;
+    using Base::phys_width;
+    using Base::phys_height;
+    using Base::software_screen_buffer;
+
+    /// @brief Buffer holds panel colors, no expansion on send
+    static constexpr bool is_native{F == PixelFormat::RGB565};
+
 private:
     /// @brief Memory Access Control (MADCTL) register bits
     enum MadCtl : u8 {
@@ -59,9 +81,28 @@ private:
     u8 logical_height{phys_height};      ///< Current logical height (after orientation)
     u8 madctl_base_mode{MadCtl::RgbMode};///< Base MADCTL value
 
+    u16 palette[is_native ? 1 : traits::palette_size]{};///< Panel color of each buffer value (packed formats)
+
 public:
-    explicit ST7735(const Config &settings, SPIClass &spi_instance) noexcept:
-        settings{settings}, spi{spi_instance} {}
+    explicit BasicST7735(const Config &settings, SPIClass &spi_instance) noexcept:
+        settings{settings}, spi{spi_instance} {
+        if constexpr (not is_native) {
+            for (usize i = 0; i < traits::palette_size; i += 1) {
+                palette[i] = traits::toRgb565(static_cast<ColorType>(i));
+            }
+        }
+    }
+
+    /// @brief Set panel color shown for buffer value (packed formats only)
+    /// @param value Buffer value (palette index for indexed formats)
+    /// @param color RGB565 color (pixel_traits<PixelFormat::RGB565>::fromRgb)
+    /// @note Takes effect on next transfer, whole screen is marked modified
+    void setPaletteColor(ColorType value, u16 color) noexcept {
+        static_assert(not is_native, "RGB565 buffer has no palette");
+
+        palette[value] = color;
+        Base::invalidate();
+    }
 
 private:
     // DisplayDriver interface implementation
@@ -94,10 +135,10 @@ private:
         delay(255);
 
         sendCommand(Command::COLMOD);
-        const u8 color_mode{0x05};// 16-bit color (RGB565)
+        const u8 color_mode{0x05};// 16-bit color (RGB565), packed buffers are expanded on send
         sendData(&color_mode, sizeof(color_mode));
 
-        setOrientation(settings.orientation);
+        Base::setOrientation(settings.orientation);
 
         sendCommand(Command::DISPON);
         delay(100);
@@ -105,10 +146,62 @@ private:
         return true;
     }
 
-    void sendImpl() const noexcept {
+    /// @brief Transfer region of software buffer to display via SPI
+    void sendImpl(const gfx::DirtyRegion &region) const noexcept {
+        sendPixels(region, software_screen_buffer + region.top * rowSize());
+    }
+
+    /// @brief Transfer band of rows rendered into strip buffer start
+    void sendBandImpl(const gfx::DirtyRegion &band) const noexcept {
+        sendPixels(band, software_screen_buffer);
+    }
+
+    /// @brief Stream pixels into display window
+    /// @details CASET/RASET window is set to the region, rows are streamed in a single RAMWR.
+    /// Packed formats are expanded through the palette into a line buffer row by row.
+    /// @param row Start of first region row, rows are rowSize() items apart
+    void sendPixels(const gfx::DirtyRegion &region, const BufferType *row) const noexcept {
+        setWindow(region);
         sendCommand(Command::RAMWR);
-        sendData(reinterpret_cast<const u8 *>(software_screen_buffer),
-                 sizeof(software_screen_buffer));
+
+        const auto row_pixels = static_cast<usize>(region.width());
+        const auto row_size = rowSize();
+
+        digitalWrite(settings.pin_data_command, HIGH);
+        digitalWrite(settings.pin_spi_slave_select, LOW);
+
+        if constexpr (is_native) {
+            row += region.left;
+
+            if (region.width() == logical_width) {
+                // Full-width rows are contiguous
+                spi.writeBytes(reinterpret_cast<const u8 *>(row), row_pixels * sizeof(BufferType) * region.height());
+            } else {
+                for (auto y = region.top; y <= region.bottom; y += 1) {
+                    spi.writeBytes(reinterpret_cast<const u8 *>(row), row_pixels * sizeof(BufferType));
+                    row += row_size;
+                }
+            }
+        } else {
+            u16 line[phys_height];
+
+            for (auto y = region.top; y <= region.bottom; y += 1) {
+                traits::expandRow(row, region.left, row_pixels, palette, line);
+                spi.writeBytes(reinterpret_cast<const u8 *>(line), row_pixels * sizeof(u16));
+                row += row_size;
+            }
+        }
+
+        digitalWrite(settings.pin_spi_slave_select, HIGH);
+    }
+
+    /// @brief Buffer items per row for current orientation
+    kf_nodiscard usize rowSize() const noexcept {
+        if constexpr (is_native) {
+            return logical_width;
+        } else {
+            return traits::rowSize(logical_width);
+        }
     }
 
     /// @brief Apply orientation transformation (full 6-way support)
@@ -135,11 +228,17 @@ private:
         sendCommand(Command::MADCTL);
         sendData(&madctl, sizeof(madctl));
 
-        u8 data[4] = {0x00, 0x00, 0x00, static_cast<u8>(logical_width - 1)};
+        setWindow(gfx::DirtyRegion::full(logical_width, logical_height));
+    }
+
+    /// @brief Set CASET/RASET address window to region
+    void setWindow(const gfx::DirtyRegion &region) const noexcept {
+        u8 data[4] = {0x00, static_cast<u8>(region.left), 0x00, static_cast<u8>(region.right)};
         sendCommand(Command::CASET);
         sendData(data, sizeof(data));
 
-        data[3] = logical_height - 1;
+        data[1] = static_cast<u8>(region.top);
+        data[3] = static_cast<u8>(region.bottom);
         sendCommand(Command::RASET);
         sendData(data, sizeof(data));
     }
@@ -182,4 +281,7 @@ private:
     }
 };
 
+/// @brief ST7735 driver with full frame buffer
+using ST7735 = BasicST7735<160>;
+
 }// namespace kf
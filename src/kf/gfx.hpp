@@ -8,7 +8,18 @@
 /// @brief KiraFlux Graphics
 namespace kf::gfx {}
 
+#include "kf/gfx/BackgroundLayer.hpp"
 #include "kf/gfx/Canvas.hpp"
+#include "kf/gfx/CompressedImage.hpp"
+#include "kf/gfx/DirtyRegion.hpp"
+#include "kf/gfx/DisplayList.hpp"
+#include "kf/gfx/Dither.hpp"
 #include "kf/gfx/DynamicImage.hpp"
 #include "kf/gfx/Font.hpp"
+#include "kf/gfx/FrameRecorder.hpp"
+#include "kf/gfx/GlyphCache.hpp"
+#include "kf/gfx/ImageView.hpp"
+#include "kf/gfx/StaticFrame.hpp"
 #include "kf/gfx/StaticImage.hpp"
+#include "kf/gfx/TextConsole.hpp"
+#include "kf/gfx/TextRun.hpp"
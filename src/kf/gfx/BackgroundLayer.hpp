@@ -0,0 +1,118 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/core/pixel_traits.hpp"
+#include "kf/gfx/Canvas.hpp"
+#include "kf/gfx/DirtyRegion.hpp"
+#include "kf/gfx/DynamicImage.hpp"
+
+
+namespace kf::gfx {
+
+/// @brief Static background cached in its own buffer and composed under per-frame foreground
+/// @tparam F Pixel format of frame and background
+/// @details The background (borders, labels, icons) is drawn once into the layer buffer,
+/// which has the geometry of the frame buffer. Each frame begin() restores the background
+/// only where the previous foreground drew or the background changed (row or page copies),
+/// foreground layers are then drawn on top and end() reports their area to the frame's dirty region.
+/// Per-frame work follows the changed area instead of whole-screen fill and redraw:
+/// @code
+/// BackgroundLayer<PixelFormat::RGB565> layer{display.image(), background_buffer};
+/// auto back = layer.background(); // once, or whenever static content changes
+/// back.fill();
+/// back.text(0, 0, "Speed:");
+///
+/// auto canvas = layer.begin();    // every frame
+/// canvas.number(40, 0, speed, 4);
+/// layer.end();
+/// display.sendDirty();
+/// @endcode
+/// @note Frame contents outside the foreground are assumed untouched between frames.
+template<PixelFormat F> struct BackgroundLayer final {
+
+private:
+    using traits = pixel_traits<F>;
+
+public:
+    using BufferType = typename traits::BufferType;///< Raw buffer element type
+    using ColorType = typename traits::ColorType;  ///< Pixel color representation
+
+private:
+    DynamicImage<F> frame;          ///< Composed frame
+    BufferType *pixels;             ///< Background buffer (frame geometry)
+    DirtyRegion background_changed; ///< Background area not yet restored into frame (absolute)
+    DirtyRegion foreground_drawn;   ///< Frame area drawn over background since last restore (absolute)
+
+public:
+    /// @brief Creates layer composing into frame
+    /// @param frame Frame view (its dirty region receives restored and drawn areas)
+    /// @param background Buffer as large as frame buffer (must outlive layer)
+    BackgroundLayer(const DynamicImage<F> &frame, BufferType *background) noexcept:
+        frame{frame},
+        pixels{background},
+        background_changed{absoluteBounds()},
+        foreground_drawn{} {}
+
+    /// @brief Get canvas drawing into background buffer
+    /// @details Changes are composed into frame on next begin()
+    kf_nodiscard Canvas<F> background() noexcept {
+        return Canvas<F>{DynamicImage<F>{
+            pixels, frame.stride,
+            frame.width, frame.height,
+            frame.offset_x, frame.offset_y,
+            &background_changed}};
+    }
+
+    /// @brief Start frame: restore background under previous foreground
+    /// @return Canvas drawing foreground into frame
+    kf_nodiscard Canvas<F> begin() noexcept {
+        DirtyRegion restored = foreground_drawn;
+        restored.add(background_changed.left, background_changed.top, background_changed.right, background_changed.bottom);
+
+        if (not restored.isEmpty()) {
+            frame.restore(
+                pixels,
+                static_cast<Pixel>(restored.left - frame.offset_x),
+                static_cast<Pixel>(restored.top - frame.offset_y),
+                static_cast<Pixel>(restored.right - frame.offset_x),
+                static_cast<Pixel>(restored.bottom - frame.offset_y));
+        }
+
+        foreground_drawn.clear();
+        background_changed.clear();
+
+        return Canvas<F>{DynamicImage<F>{
+            frame.buffer, frame.stride,
+            frame.width, frame.height,
+            frame.offset_x, frame.offset_y,
+            &foreground_drawn}};
+    }
+
+    /// @brief Finish frame: add foreground area to frame dirty region
+    void end() const noexcept {
+        if (nullptr == frame.dirty or foreground_drawn.isEmpty()) { return; }
+
+        frame.dirty->add(foreground_drawn.left, foreground_drawn.top, foreground_drawn.right, foreground_drawn.bottom);
+    }
+
+    /// @brief Restore whole background on next begin() (e.g. after frame was overdrawn elsewhere)
+    void invalidate() noexcept { background_changed = absoluteBounds(); }
+
+    /// @brief Background buffer (frame geometry), e.g. for Canvas::restore
+    kf_nodiscard const BufferType *buffer() const noexcept { return pixels; }
+
+private:
+    /// @brief Frame bounds in absolute coordinates
+    kf_nodiscard DirtyRegion absoluteBounds() const noexcept {
+        return DirtyRegion{
+            frame.offset_x, frame.offset_y,
+            static_cast<Pixel>(frame.offset_x + frame.width - 1),
+            static_cast<Pixel>(frame.offset_y + frame.height - 1)};
+    }
+};
+
+}// namespace kf::gfx
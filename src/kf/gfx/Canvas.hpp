@@ -4,16 +4,23 @@
 #pragma once
 
 #include <cmath>
+#include <type_traits>
 
 #include "kf/Result.hpp"
+#include "kf/core/RasterOp.hpp"
 #include "kf/core/attributes.hpp"
 #include "kf/core/pixel_traits.hpp"
+#include "kf/math/units.hpp"
 #include "kf/memory/Array.hpp"
 
 #include "kf/gfx/ColorPalette.hpp"
+#include "kf/gfx/CompressedImage.hpp"
 #include "kf/gfx/DynamicImage.hpp"
 #include "kf/gfx/Font.hpp"
+#include "kf/gfx/GlyphCache.hpp"
+#include "kf/gfx/StaticFrame.hpp"
 #include "kf/gfx/StaticImage.hpp"
+#include "kf/gfx/TextRun.hpp"
 #include "ColorPalette.hpp"
 
 
@@ -21,7 +28,10 @@ namespace kf::gfx {
 
 /// @brief Drawing context with graphics primitives and text rendering
 /// @tparam F Pixel format for canvas operations
-template<PixelFormat F> struct Canvas {
+/// @tparam Frame Target view: DynamicImage (runtime geometry) or StaticFrame (see StaticCanvas)
+/// @details Sub-canvases are always runtime Canvas<F>.
+template<PixelFormat F, typename Frame = DynamicImage<F>> struct Canvas {
+    template<PixelFormat, typename> friend struct Canvas;
 
 private:
     using traits = pixel_traits<F>;
@@ -29,20 +39,58 @@ private:
 public:
     using Palette = ColorPalette<F>; ///<Color Palette
     using ColorType = typename traits::ColorType;///< Color representation type
+    using BufferType = typename traits::BufferType;///< Raw buffer element type
+
+    /// @brief Clipping rectangle in canvas coordinates (inclusive bounds)
+    struct ClipRect {
+        Pixel x0;///< Leftmost visible column
+        Pixel y0;///< Topmost visible row
+        Pixel x1;///< Rightmost visible column
+        Pixel y1;///< Bottommost visible row
+
+        /// @brief Checks if nothing is visible
+        kf_nodiscard bool isEmpty() const noexcept { return x0 > x1 or y0 > y1; }
+
+        /// @brief Checks if point is visible
+        kf_nodiscard bool contains(Pixel x, Pixel y) const noexcept {
+            return x >= x0 and x <= x1 and y >= y0 and y <= y1;
+        }
+
+        /// @brief Checks if rectangle [left, right] x [top, bottom] is fully visible
+        kf_nodiscard bool contains(Pixel left, Pixel top, Pixel right, Pixel bottom) const noexcept {
+            return left >= x0 and right <= x1 and top >= y0 and bottom <= y1;
+        }
+
+        /// @brief Intersection with other rectangle
+        kf_nodiscard ClipRect intersect(const ClipRect &other) const noexcept {
+            return {
+                kf::max(x0, other.x0), kf::max(y0, other.y0),
+                kf::min(x1, other.x1), kf::min(y1, other.y1),
+            };
+        }
+    };
+
+    /// @brief Maximum number of saved clip rectangles
+    static constexpr u8 clip_stack_depth = 4;
 
 private:
     static constexpr ColorType default_foreground_color{Palette::getAnsiColor(Palette::Ansi::WhiteBright)};
     static constexpr ColorType default_background_color{Palette::getAnsiColor(Palette::Ansi::Black)};
 
-    DynamicImage<F> frame;     ///< Target drawing surface
+    Frame frame;               ///< Target drawing surface
     const Font *current_font;  ///< Currently selected font
     ColorType foreground_color;///< Drawing color
     ColorType background_color;///< Background/fill color
     bool auto_next_line;       ///< Automatically wrap text to next line
+    GlyphCache<F> *glyph_cache;///< Optional cache of expanded glyphs
+    u8 text_scale;             ///< Text magnification (each glyph pixel is a text_scale square)
+    ClipRect clip;             ///< Current clipping rectangle
+    ClipRect clip_stack[clip_stack_depth];///< Saved clipping rectangles
+    u8 clip_depth;             ///< Number of saved clipping rectangles
 
 public:
     explicit Canvas(
-        const DynamicImage<F> &frame,
+        const Frame &frame,
         const Font &font = Font::blank(),
         ColorType foreground = default_foreground_color,
         ColorType background = default_background_color
@@ -51,7 +99,12 @@ public:
         current_font{&font},
         foreground_color{foreground},
         background_color{background},
-        auto_next_line{false} {}
+        auto_next_line{false},
+        glyph_cache{nullptr},
+        text_scale{1},
+        clip{fullClip()},
+        clip_stack{},
+        clip_depth{0} {}
 
     /// @brief Default constructor - creates invalid canvas
     explicit Canvas() noexcept:
@@ -59,7 +112,12 @@ public:
         current_font{&Font::blank()},
         foreground_color{default_foreground_color},
         background_color{default_background_color},
-        auto_next_line{false} {}
+        auto_next_line{false},
+        glyph_cache{nullptr},
+        text_scale{1},
+        clip{fullClip()},
+        clip_stack{},
+        clip_depth{0} {}
 
     /// @brief Creates validated sub-canvas within current bounds
     /// @param width Sub-canvas width
@@ -67,29 +125,35 @@ public:
     /// @param offset_x X offset within current canvas
     /// @param offset_y Y offset within current canvas
     /// @return Sub-canvas or error if out of bounds
-    Result<Canvas, typename DynamicImage<F>::Error> sub(
+    Result<Canvas<F>, typename DynamicImage<F>::Error> sub(
         Pixel width, Pixel height,
         Pixel offset_x, Pixel offset_y
     ) noexcept {
         const auto frame_result = frame.sub(width, height, offset_x, offset_y);
         if (frame_result.isOk()) {
-            return {Canvas{frame_result.ok().value(), *current_font, foreground_color, background_color}};
+            Canvas<F> canvas{frame_result.ok().value(), *current_font, foreground_color, background_color};
+            canvas.glyph_cache = glyph_cache;
+            canvas.text_scale = text_scale;
+            return {canvas};
         }
         return {frame_result.error().value()};
     }
 
     /// @brief Creates sub-canvas without validation
     /// @warning No bounds checking - caller must ensure parameters are valid
-    Canvas subUnchecked(
+    Canvas<F> subUnchecked(
         Pixel width, Pixel height,
         Pixel offset_x, Pixel offset_y
     ) noexcept {
-        return Canvas{
+        Canvas<F> canvas{
             frame.subUnchecked(width, height, offset_x, offset_y),
             *current_font,
             foreground_color,
             background_color
         };
+        canvas.glyph_cache = glyph_cache;
+        canvas.text_scale = text_scale;
+        return canvas;
     }
 
     // Attributes
@@ -112,20 +176,23 @@ public:
     /// @brief Get vertical center coordinate
     kf_nodiscard Pixel centerY() const noexcept { return static_cast<Pixel>(maxY() / 2); }
 
-    /// @brief Get tab width based on current font (4 character widths)
-    kf_nodiscard Pixel tabWidth() const noexcept { return static_cast<Pixel>(current_font->widthTotal() * 4); }
+    /// @brief Get tab width based on current font and text scale (4 character widths)
+    kf_nodiscard Pixel tabWidth() const noexcept { return static_cast<Pixel>(glyphWidth() * 4); }
 
     /// @brief Get canvas width in glyphs
-    kf_nodiscard u8 widthInGlyphs() const noexcept { return frame.width / current_font->widthTotal(); }
+    kf_nodiscard u8 widthInGlyphs() const noexcept { return frame.width / glyphWidth(); }
 
     /// @brief Get canvas height in glyphs
-    kf_nodiscard u8 heightInGlyphs() const noexcept { return frame.height / current_font->heightTotal(); }
+    kf_nodiscard u8 heightInGlyphs() const noexcept { return frame.height / glyphHeight(); }
+
+    /// @brief Get current font glyph width with spacing and text scale
+    kf_nodiscard Pixel glyphWidth() const noexcept { return static_cast<Pixel>(current_font->widthTotal() * text_scale); }
 
-    /// @brief Get current font glyph width
-    kf_nodiscard Pixel glyphWidth() const noexcept { return current_font->widthTotal(); }
+    /// @brief Get current font glyph height with spacing and text scale
+    kf_nodiscard Pixel glyphHeight() const noexcept { return static_cast<Pixel>(current_font->heightTotal() * text_scale); }
 
-    /// @brief Get current font glyph height
-    kf_nodiscard Pixel glyphHeight() const noexcept { return current_font->heightTotal(); }
+    /// @brief Get text magnification
+    kf_nodiscard u8 textScale() const noexcept { return text_scale; }
 
     /// Current Foreground color
     kf_nodiscard ColorType foreground() const noexcept { return foreground_color; }
@@ -150,12 +217,49 @@ public:
     /// @brief Enable/disable automatic text wrapping to next line
     void setAutoNextLine(bool enable) noexcept { auto_next_line = enable; }
 
+    /// @brief Set text magnification (shared with sub-canvases)
+    /// @param scale Size of square drawn per glyph pixel (0 is treated as 1)
+    /// @details Scaled glyphs are drawn as fills of merged pixel runs, not per pixel.
+    void setTextScale(u8 scale) noexcept { text_scale = kf::max(scale, u8{1}); }
+
+    /// @brief Set cache of expanded glyphs used by text rendering (shared with sub-canvases)
+    /// @param cache Glyph cache (must outlive canvas) or nullptr to expand glyphs on each draw
+    /// @note Worth it for RGB565, monochrome glyphs are already written as whole bytes
+    void setGlyphCache(GlyphCache<F> *cache) noexcept { glyph_cache = cache; }
+
+    // Clipping
+
+    /// @brief Restrict drawing to rectangle [x0, x1] x [y0, y1] (intersected with current clip)
+    /// @return false if clip stack is full (clip left unchanged)
+    kf_nodiscard bool pushClip(Pixel x0, Pixel y0, Pixel x1, Pixel y1) noexcept {
+        if (clip_depth >= clip_stack_depth) { return false; }
+
+        if (x0 > x1) { std::swap(x0, x1); }
+        if (y0 > y1) { std::swap(y0, y1); }
+
+        clip_stack[clip_depth] = clip;
+        clip_depth += 1;
+        clip = clip.intersect(ClipRect{x0, y0, x1, y1});
+        return true;
+    }
+
+    /// @brief Restore clipping rectangle saved by matching pushClip()
+    void popClip() noexcept {
+        if (clip_depth == 0) { return; }
+
+        clip_depth -= 1;
+        clip = clip_stack[clip_depth];
+    }
+
+    /// @brief Current clipping rectangle
+    kf_nodiscard const ClipRect &clipRect() const noexcept { return clip; }
+
     /// @brief Split canvas into weighted sub-canvases
     /// @tparam N Number of sub-canvases to create
     /// @param weights Relative weights for each sub-canvas
     /// @param horizontal True for horizontal split, false for vertical
     /// @return Array of sub-canvases with proportional sizes
-    template<usize N> Array<Canvas, N> split(Array<usize, N> weights, bool horizontal = true) noexcept {
+    template<usize N> Array<Canvas<F>, N> split(Array<usize, N> weights, bool horizontal = true) noexcept {
         static_assert(N > 0, "Cannot split with zero items");
         for (auto &w: weights) {
             if (w == 0) { w = 1; }
@@ -169,7 +273,7 @@ public:
         auto remaining = horizontal ? width() : height();
         auto offset = 0u;
 
-        Array<Canvas, N> result;
+        Array<Canvas<F>, N> result;
         for (usize i = 0; i < N; i += 1) {
             Pixel size = (remaining * weights[i]) / total_weight;
             if (i == N - 1) { size = remaining; }
@@ -189,16 +293,55 @@ public:
 
     // Drawing API
 
-    /// @brief Fill entire canvas with background color
+    /// @brief Fill entire canvas (visible part) with background color
     void fill() const noexcept {
-        frame.fill(background_color);
+        if (0 == clip_depth) {
+            frame.fill(background_color);
+        } else {
+            fillRect(clip.x0, clip.y0, clip.x1, clip.y1, background_color);
+        }
+    }
+
+    /// @brief Move canvas contents (visible part) by (dx, dy), filling uncovered strips with background color
+    /// @details Pixels are moved in place (row memmove, page shifts for monochrome),
+    /// so log views draw only their newest line. Pixels moved past clip edges are dropped.
+    void scroll(Pixel dx, Pixel dy) noexcept {
+        if (clip.isEmpty() or (dx == 0 and dy == 0)) { return; }
+
+        const auto visible_width = static_cast<Pixel>(clip.x1 - clip.x0 + 1);
+        const auto visible_height = static_cast<Pixel>(clip.y1 - clip.y0 + 1);
+
+        if (dx <= -visible_width or dx >= visible_width or dy <= -visible_height or dy >= visible_height) {
+            fillRect(clip.x0, clip.y0, clip.x1, clip.y1, background_color);
+            return;
+        }
+
+        if (0 == clip_depth) {
+            frame.scroll(dx, dy);
+        } else {
+            clipFrame().scroll(dx, dy);
+        }
+
+        if (dx > 0) {
+            fillRect(clip.x0, clip.y0, static_cast<Pixel>(clip.x0 + dx - 1), clip.y1, background_color);
+        } else if (dx < 0) {
+            fillRect(static_cast<Pixel>(clip.x1 + dx + 1), clip.y0, clip.x1, clip.y1, background_color);
+        }
+
+        if (dy > 0) {
+            fillRect(clip.x0, clip.y0, clip.x1, static_cast<Pixel>(clip.y0 + dy - 1), background_color);
+        } else if (dy < 0) {
+            fillRect(clip.x0, static_cast<Pixel>(clip.y1 + dy + 1), clip.x1, clip.y1, background_color);
+        }
     }
 
     /// @brief Draw single pixel at specified coordinates
     /// @param x X coordinate
     /// @param y Y coordinate
     void dot(Pixel x, Pixel y) const noexcept {
-        frame.setPixel(x, y, foreground_color);
+        if (clip.contains(x, y)) {
+            frame.setPixel(x, y, foreground_color);
+        }
     }
 
     /// @brief Draw static image at specified position
@@ -207,18 +350,201 @@ public:
     /// @param x Left position
     /// @param y Top position
     /// @param image Image to draw
-    template<Pixel W, Pixel H> void image(Pixel x, Pixel y, const StaticImage<F, W, H> &image) noexcept {
-        traits::copy(
-            image.buffer, image.width(), image.height(),
-            frame.buffer, frame.stride, frame.width, frame.height,
-            x, y);
+    /// @param op Raster operation (Copy overwrites, Or/AndNot/Xor draw icons and masks)
+    template<Pixel W, Pixel H> void image(
+        Pixel x, Pixel y,
+        const StaticImage<F, W, H> &image,
+        RasterOp op = RasterOp::Copy
+    ) noexcept {
+        this->image(x, y, image.buffer, image.width(), image.height(), op);
+    }
+
+    /// @brief Draw raw image buffer at specified position
+    /// @param x Left position
+    /// @param y Top position
+    /// @param pixels Image buffer in canvas pixel format
+    /// @param image_width Image width in pixels
+    /// @param image_height Image height in pixels
+    /// @param op Raster operation
+    void image(
+        Pixel x, Pixel y,
+        const BufferType *pixels,
+        Pixel image_width, Pixel image_height,
+        RasterOp op = RasterOp::Copy
+    ) noexcept {
+        if (clip.contains(x, y, static_cast<Pixel>(x + image_width - 1), static_cast<Pixel>(y + image_height - 1))) {
+            frame.copy(x, y, pixels, image_width, image_height, op);
+            return;
+        }
+
+        if (clip.isEmpty()) { return; }
+        clipFrame().copy(static_cast<Pixel>(x - clip.x0), static_cast<Pixel>(y - clip.y0), pixels, image_width, image_height, op);
+    }
+
+    /// @brief Draw sprite with transparent color key
+    /// @details Pixels equal to key leave the frame untouched
+    /// @param x Left position
+    /// @param y Top position
+    /// @param image Sprite image
+    /// @param key Transparent color
+    template<Pixel W, Pixel H> void transparentImage(
+        Pixel x, Pixel y,
+        const StaticImage<F, W, H> &image,
+        ColorType key
+    ) noexcept {
+        transparentImage(x, y, image.buffer, W, H, key);
+    }
+
+    /// @brief Draw raw sprite buffer with transparent color key
+    /// @param pixels Image buffer in canvas pixel format
+    /// @param image_width Image width in pixels
+    /// @param image_height Image height in pixels
+    /// @param key Transparent color
+    void transparentImage(
+        Pixel x, Pixel y,
+        const BufferType *pixels,
+        Pixel image_width, Pixel image_height,
+        ColorType key
+    ) noexcept {
+        if (clip.contains(x, y, static_cast<Pixel>(x + image_width - 1), static_cast<Pixel>(y + image_height - 1))) {
+            frame.copyKeyed(x, y, pixels, image_width, image_height, key);
+            return;
+        }
+
+        if (clip.isEmpty()) { return; }
+        clipFrame().copyKeyed(static_cast<Pixel>(x - clip.x0), static_cast<Pixel>(y - clip.y0), pixels, image_width, image_height, key);
+    }
+
+    /// @brief Draw sprite through 1-bit alpha mask
+    /// @details Only pixels with set mask bits are drawn
+    /// @param x Left position
+    /// @param y Top position
+    /// @param image Sprite image
+    /// @param mask Monochrome mask of the same size
+    template<Pixel W, Pixel H> void maskedImage(
+        Pixel x, Pixel y,
+        const StaticImage<F, W, H> &image,
+        const StaticImage<PixelFormat::Monochrome, W, H> &mask
+    ) noexcept {
+        maskedImage(x, y, image.buffer, mask.buffer, W, H);
+    }
+
+    /// @brief Draw raw sprite buffer through 1-bit alpha mask
+    /// @param pixels Image buffer in canvas pixel format
+    /// @param mask Mask column bytes (monochrome page layout, image size)
+    /// @param image_width Image width in pixels
+    /// @param image_height Image height in pixels
+    void maskedImage(
+        Pixel x, Pixel y,
+        const BufferType *pixels, const u8 *mask,
+        Pixel image_width, Pixel image_height
+    ) noexcept {
+        if (clip.contains(x, y, static_cast<Pixel>(x + image_width - 1), static_cast<Pixel>(y + image_height - 1))) {
+            frame.copyMasked(x, y, pixels, image_width, image_height, mask);
+            return;
+        }
+
+        if (clip.isEmpty()) { return; }
+        clipFrame().copyMasked(static_cast<Pixel>(x - clip.x0), static_cast<Pixel>(y - clip.y0), pixels, image_width, image_height, mask);
+    }
+
+    /// @brief Draw monochrome image in foreground and background colors
+    /// @details Lets 1-bit icons serve canvases of any pixel format
+    /// @param x Left position
+    /// @param y Top position
+    /// @param image Monochrome image (page layout)
+    /// @param transparent Leave pixels of clear bits untouched instead of drawing background
+    template<Pixel W, Pixel H> void bitmap(
+        Pixel x, Pixel y,
+        const StaticImage<PixelFormat::Monochrome, W, H> &image,
+        bool transparent = false
+    ) noexcept {
+        bitmap(x, y, image.buffer, W, H, transparent);
+    }
+
+    /// @brief Draw raw 1-bit bitmap in foreground and background colors
+    /// @param bits Bitmap column bytes, bitmap_width bytes per 8-pixel page
+    /// @param bitmap_width Bitmap width in pixels
+    /// @param bitmap_height Bitmap height in pixels
+    /// @param transparent Leave pixels of clear bits untouched instead of drawing background
+    void bitmap(
+        Pixel x, Pixel y,
+        const u8 *bits,
+        Pixel bitmap_width, Pixel bitmap_height,
+        bool transparent = false
+    ) noexcept {
+        const bool visible = clip.contains(x, y, static_cast<Pixel>(x + bitmap_width - 1), static_cast<Pixel>(y + bitmap_height - 1));
+        if (not visible and clip.isEmpty()) { return; }
+
+        const auto draw = [&](const auto &target, Pixel target_x, Pixel target_y) {
+            if (transparent) {
+                target.bitmapTransparent(target_x, target_y, bits, bitmap_width, bitmap_height, foreground_color);
+            } else {
+                target.bitmap(target_x, target_y, bits, bitmap_width, bitmap_height, foreground_color, background_color);
+            }
+        };
+
+        if (visible) {
+            draw(frame, x, y);
+        } else {
+            draw(clipFrame(), static_cast<Pixel>(x - clip.x0), static_cast<Pixel>(y - clip.y0));
+        }
+    }
+
+    /// @brief Restore rectangle [x0, x1] x [y0, y1] from background buffer (clipped)
+    /// @param background Buffer with the same geometry as canvas frame buffer (see BackgroundLayer)
+    /// @details Erases foreground drawing (e.g. a moving sprite) with row or page copies.
+    void restore(const BufferType *background, Pixel x0, Pixel y0, Pixel x1, Pixel y1) const noexcept {
+        if (x0 > x1) { std::swap(x0, x1); }
+        if (y0 > y1) { std::swap(y0, y1); }
+
+        frame.restore(
+            background,
+            kf::max(x0, clip.x0), kf::max(y0, clip.y0),
+            kf::min(x1, clip.x1), kf::min(y1, clip.y1));
+    }
+
+    /// @brief Draw compressed image at specified position
+    /// @details Image is decoded straight into the frame: runs become fills, literals are copied
+    template<Pixel W, Pixel H, usize N> void image(
+        Pixel x, Pixel y,
+        const CompressedImage<F, W, H, N> &image
+    ) noexcept {
+        compressedImage(x, y, image.data, N, W, H);
+    }
+
+    /// @brief Draw compressed image stream at specified position
+    /// @param data Stream in pixel_traits<F>::decode encoding
+    /// @param size Stream length in buffer elements
+    /// @param image_width Image width in pixels
+    /// @param image_height Image height in pixels
+    void compressedImage(
+        Pixel x, Pixel y,
+        const BufferType *data, usize size,
+        Pixel image_width, Pixel image_height
+    ) noexcept {
+        if (clip.isEmpty()) { return; }
+
+        traits::decode(
+            data, size, image_width, image_height,
+            [this, x, y](Pixel x0, Pixel y0, Pixel x1, Pixel y1, ColorType color) {
+                fillRect(
+                    static_cast<Pixel>(x + x0), static_cast<Pixel>(y + y0),
+                    static_cast<Pixel>(x + x1), static_cast<Pixel>(y + y1),
+                    color);
+            },
+            [this, x, y](Pixel copy_x, Pixel copy_y, const BufferType *pixels, Pixel width, Pixel height) {
+                image(static_cast<Pixel>(x + copy_x), static_cast<Pixel>(y + copy_y), pixels, width, height);
+            });
     }
 
     /// @brief Draw line (x0, y0), (x1, y1) between two points
+    /// @details Invisible lines are rejected by Cohen–Sutherland region codes, partially visible
+    /// lines are clipped analytically and rasterized over visible part only
     void line(Pixel x0, Pixel y0, Pixel x1, Pixel y1) const noexcept {
         if (x0 == x1) {
             if (y0 == y1) {
-                frame.setPixel(x0, y0, foreground_color);
+                dot(x0, y0);
             } else {
                 drawLineVertical(x0, y0, y1, foreground_color);
             }
@@ -230,26 +556,49 @@ public:
             return;
         }
 
-        const auto dx = static_cast<Pixel>(std::abs(x1 - x0));
-        const auto dy = static_cast<Pixel>(-std::abs(y1 - y0));
-        const auto sx = (x0 < x1) ? 1 : -1;
-        const auto sy = (y0 < y1) ? 1 : -1;
-        auto error = dx + dy;
+        const u8 code0 = outCode(x0, y0);
+        const u8 code1 = outCode(x1, y1);
 
-        while (true) {
-            frame.setPixel(x0, y0, foreground_color);
-            if (x0 == x1 and y0 == y1) { break; }
+        // Both endpoints beyond the same edge
+        if (0 != (code0 & code1)) { return; }
+
+        const i32 adx = std::abs(x1 - x0);
+        const i32 ady = std::abs(y1 - y0);
+        const i32 sx = (x0 < x1) ? 1 : -1;
+        const i32 sy = (y0 < y1) ? 1 : -1;
+        const bool x_major = adx >= ady;
+
+        // Visible range of steps along major axis (whole line if both endpoints are inside)
+        i32 first = 0;
+        i32 last = x_major ? adx : ady;
+
+        if (0 != (code0 | code1)) {
+            const bool visible = x_major
+                                     ? visibleSteps(x0, y0, adx, ady, sx, sy, clip.x0, clip.x1, clip.y0, clip.y1, first, last)
+                                     : visibleSteps(y0, x0, ady, adx, sy, sx, clip.y0, clip.y1, clip.x0, clip.x1, first, last);
+            if (not visible) { return; }
+        }
+
+        // Resume Bresenham at first visible step: same pixels as unclipped walk
+        const i64 i = x_major ? first : (2 * i64{adx} * first + ady) / (2 * i64{ady});
+        const i64 j = x_major ? (2 * i64{ady} * first + adx) / (2 * i64{adx}) : first;
+
+        auto x = static_cast<Pixel>(x0 + sx * i);
+        auto y = static_cast<Pixel>(y0 + sy * j);
+        auto error = static_cast<i32>(adx * (j + 1) - ady * (i + 1));
+
+        for (i32 remaining = last - first;; remaining -= 1) {
+            frame.setPixel(x, y, foreground_color);
+            if (remaining == 0) { break; }
 
             const auto double_error = 2 * error;
-            if (double_error >= dy) {
-                if (x0 == x1) { break; }
-                error += dy;
-                x0 = static_cast<Pixel>(x0 + sx);
+            if (double_error >= -ady) {
+                error -= ady;
+                x = static_cast<Pixel>(x + sx);
             }
-            if (double_error <= dx) {
-                if (y0 == y1) { break; }
-                error += dx;
-                y0 = static_cast<Pixel>(y0 + sy);
+            if (double_error <= adx) {
+                error += adx;
+                y = static_cast<Pixel>(y + sy);
             }
         }
     }
@@ -260,7 +609,7 @@ public:
         if (y0 > y1) { std::swap(y0, y1); }
 
         if (fill) {
-            frame.fill(x0, y0, x1, y1, foreground_color);
+            fillRect(x0, y0, x1, y1, foreground_color);
         } else {
             // Outline
             drawLineHorizontal(x0, y0, x1, foreground_color);
@@ -273,173 +622,580 @@ public:
 
     /// @brief Draw circle (filled or outline)
     void circle(Pixel cx, Pixel cy, Pixel r, bool fill) noexcept {
-        if (r < 0) { return; }
+        ellipse(cx, cy, r, r, fill);
+    }
+
+    /// @brief Draw axis-aligned ellipse (filled or outline)
+    /// @param rx Horizontal radius
+    /// @param ry Vertical radius
+    void ellipse(Pixel cx, Pixel cy, Pixel rx, Pixel ry, bool fill) noexcept {
+        if (rx < 0 or ry < 0) { return; }
+
+        const bool inside = clip.contains(
+            static_cast<Pixel>(cx - rx), static_cast<Pixel>(cy - ry),
+            static_cast<Pixel>(cx + rx), static_cast<Pixel>(cy + ry));
+
+        forEachEllipseRow(rx, ry, [&](Pixel dy, Pixel outer, Pixel inner) {
+            drawMirroredSpans(cx, cx, cy, cy, dy, fill ? Pixel{0} : inner, outer, not inside);
+        });
+    }
+
+    /// @brief Draw rectangle with rounded corners (filled or outline)
+    /// @param r Corner radius (limited to half of the smaller side)
+    void roundRect(Pixel x0, Pixel y0, Pixel x1, Pixel y1, Pixel r, bool fill) noexcept {
+        if (x0 > x1) { std::swap(x0, x1); }
+        if (y0 > y1) { std::swap(y0, y1); }
+
+        r = kf::min<Pixel>(r, static_cast<Pixel>(kf::min(x1 - x0, y1 - y0) / 2));
+        if (r <= 0) {
+            rect(x0, y0, x1, y1, fill);
+            return;
+        }
+
+        const auto left_cx = static_cast<Pixel>(x0 + r);
+        const auto right_cx = static_cast<Pixel>(x1 - r);
+        const auto top_cy = static_cast<Pixel>(y0 + r);
+        const auto bottom_cy = static_cast<Pixel>(y1 - r);
+
+        const bool inside = clip.contains(x0, y0, x1, y1);
+
+        forEachEllipseRow(r, r, [&](Pixel dy, Pixel outer, Pixel inner) {
+            drawMirroredSpans(left_cx, right_cx, top_cy, bottom_cy, dy, fill ? Pixel{0} : inner, outer, not inside);
+        });
+
+        if (bottom_cy - top_cy < 2) { return; }
+
+        const auto middle_y0 = static_cast<Pixel>(top_cy + 1);
+        const auto middle_y1 = static_cast<Pixel>(bottom_cy - 1);
 
         if (fill) {
-            // Fill circle
-            const auto r_squared = r * r;
-            for (auto y = -r; y <= r; y += 1) {
-                const int y_squared = y * y;
-                const auto width = static_cast<int>(std::sqrt(r_squared - y_squared));
-
-                // todo lineH
-                for (auto x = -width; x <= width; x += 1) {
-                    frame.setPixel(static_cast<Pixel>(cx + x), static_cast<Pixel>(cy + y), foreground_color);
-                }
-            }
+            fillRect(x0, middle_y0, x1, middle_y1, foreground_color);
         } else {
-            // Outline circle - modified Bresenham algorithm
-            Pixel x = r;
-            Pixel y = 0;
-            int err = 0;
-
-            while (x >= y) {
-                // Draw 8 symmetric points
-                drawCirclePoints(cx, cy, x, y, foreground_color);
-
-                // Avoid drawing duplicate points when x == y
-                if (x != y) {
-                    drawCirclePoints(cx, cy, y, x, foreground_color);
-                }
+            drawLineVertical(x0, middle_y0, middle_y1, foreground_color);
+            drawLineVertical(x1, middle_y0, middle_y1, foreground_color);
+        }
+    }
+
+    /// @brief Draw circular arc (outline) or sector (filled)
+    /// @param start Start angle in degrees, counter-clockwise from positive X axis
+    /// @param end End angle in degrees, counter-clockwise from positive X axis
+    /// @note Equal start and end angles draw the full circle
+    void arc(Pixel cx, Pixel cy, Pixel r, Degrees start, Degrees end, bool fill = false) noexcept {
+        if (r < 0) { return; }
 
-                y += 1;
-                err += 2 * y - 1;
+        start %= 360;
+        end %= 360;
+        const auto sweep = static_cast<Degrees>((end + 360 - start) % 360);
+        if (sweep == 0) {
+            circle(cx, cy, r, fill);
+            return;
+        }
+
+        // Boundary direction vectors, fixed point (trigonometry once per call)
+        constexpr f32 scale = 1024.0f;
+        constexpr f32 to_radians = 3.14159265f / 180.0f;
+        const i32 start_x = static_cast<i32>(std::cos(start * to_radians) * scale);
+        const i32 start_y = static_cast<i32>(std::sin(start * to_radians) * scale);
+        const i32 end_x = static_cast<i32>(std::cos(end * to_radians) * scale);
+        const i32 end_y = static_cast<i32>(std::sin(end * to_radians) * scale);
+
+        // Row solution of a * x + b >= 0 as inclusive x range (empty if lo > hi)
+        struct Range {
+            i32 lo, hi;
+        };
 
-                // Update x if needed
-                if (err > 0) {
-                    x -= 1;
-                    err -= 2 * x + 1;
+        constexpr i32 unbounded{1 << 20};// Beyond any Pixel, no overflow when stepped past
+
+        const auto half_plane = [](i32 a, i32 b) -> Range {
+            const auto floor_div = [](i32 n, i32 d) { return (n >= 0) ? n / d : -((-n + d - 1) / d); };
+            if (a > 0) { return {-floor_div(b, a), unbounded}; }
+            if (a < 0) { return {-unbounded, floor_div(b, -a)}; }
+            return (b >= 0) ? Range{-unbounded, unbounded} : Range{unbounded, -unbounded};
+        };
+
+        // Visible x ranges of each row from both boundary rays, halves of the row span are clipped to them
+        forEachEllipseRow(r, r, [&](Pixel dy, Pixel outer, Pixel inner) {
+            const auto draw_row = [&](Pixel row_dy) {
+                // Screen Y grows down, angles grow counter-clockwise:
+                // after start: start_x * py - start_y * x >= 0, before end: end_y * x - end_x * py >= 0
+                const i32 py = -row_dy;
+                const i32 start_a = -start_y, start_b = start_x * py;
+                const i32 end_a = end_y, end_b = -end_x * py;
+
+                Range visible[2];
+                if (sweep <= 180) {
+                    // Between both rays
+                    const auto after_start = half_plane(start_a, start_b);
+                    const auto before_end = half_plane(end_a, end_b);
+                    visible[0] = {kf::max(after_start.lo, before_end.lo), kf::min(after_start.hi, before_end.hi)};
+                    visible[1] = {unbounded, -unbounded};
+                } else {
+                    // Everything except the gap outside both rays
+                    const auto before_start = half_plane(-start_a, -start_b - 1);
+                    const auto after_end = half_plane(-end_a, -end_b - 1);
+                    const Range gap{kf::max(before_start.lo, after_end.lo), kf::min(before_start.hi, after_end.hi)};
+
+                    if (gap.lo > gap.hi) {
+                        visible[0] = {-unbounded, unbounded};
+                        visible[1] = {unbounded, -unbounded};
+                    } else {
+                        visible[0] = {-unbounded, gap.lo - 1};
+                        visible[1] = {gap.hi + 1, unbounded};
+                    }
                 }
+
+                const auto y = static_cast<Pixel>(cy + row_dy);
+                const auto draw_part = [&](i32 x_begin, i32 x_end) {
+                    for (const auto &range: visible) {
+                        const auto lo = kf::max(x_begin, range.lo);
+                        const auto hi = kf::min(x_end, range.hi);
+                        if (lo <= hi) {
+                            drawSpan(static_cast<Pixel>(cx + lo), static_cast<Pixel>(cx + hi), y, foreground_color);
+                        }
+                    }
+                };
+
+                const auto first = fill ? Pixel{0} : inner;
+                if (first == 0) {
+                    draw_part(-outer, outer);
+                } else {
+                    draw_part(-outer, -first);
+                    draw_part(first, outer);
+                }
+            };
+
+            draw_row(static_cast<Pixel>(-dy));
+            if (dy != 0) {
+                draw_row(dy);
             }
-        }
+        });
     }
 
-    /// @brief Draw text at specified position
-    /// @details Supports formatting codes:
-    ///   \x80 - Normal color mode (text - fg, bg)
-    ///   \x81 - Invert color mode (bg, text - fg)
-    ///   \x82 - Set cursor at center x
-    ///   \x83 - Set custom foreground color (ANSI color index)
-    ///   \x84 - Set custom background color (ANSI color index)
+    /// @brief Draw UTF-8 text at specified position
+    /// @details Supports control sequences (ESC N, ESC I, ESC S, ESC F h, ESC B h, see TextControl) and:
     ///   \n - New line
     ///   \t - Tab (4 character widths)
+    /// Characters without glyph in current font are drawn as boxes.
     void text(Pixel start_x, Pixel start_y, const char *text) noexcept {
-        Pixel cursor_x = start_x;
-        Pixel cursor_y = start_y;
-        const u8 font_width = current_font->glyph_width;
-        const u8 font_height = current_font->glyph_height;
-        const u8 font_total_height = current_font->heightTotal();
-        ColorType current_foreground_color = foreground_color;
-        ColorType current_background_color = background_color;
-
-        for (; *text != '\0'; ++text) {
-            switch (*text) {
-                case '\x80': {
-                    current_foreground_color = foreground_color;
-                    current_background_color = background_color;
-                    continue;
-                }
-                case '\x81': {
-                    current_foreground_color = background_color;
-                    current_background_color = foreground_color;
-                    continue;
-                }
+        TextCursor cursor{start_x, start_x, start_y, foreground_color, background_color, TextMode::Flow};
 
-                case '\x82': {
-                    std::swap(current_background_color, current_foreground_color);
-                    continue;
-                }
-                case '\xF0':
-                case '\xF1':
-                case '\xF2':
-                case '\xF3':
-                case '\xF4':
-                case '\xF5':
-                case '\xF6':
-                case '\xF7':
-                case '\xF8':
-                case '\xF9':
-                case '\xFA':
-                case '\xFB':
-                case '\xFC':
-                case '\xFD':
-                case '\xFE':
-                case '\xFF': {
-                    current_foreground_color = Palette::getAnsiColor(static_cast<typename Palette::Ansi>(*text));
-                    continue;
-                }
+        while (true) {
+            const auto token = TextRun::next(*current_font, text);
+            if (token == TextRun::End or not textToken(cursor, token)) { return; }
+        }
+    }
 
-                case '\xB0':
-                case '\xB1':
-                case '\xB2':
-                case '\xB3':
-                case '\xB4':
-                case '\xB5':
-                case '\xB6':
-                case '\xB7':
-                case '\xB8':
-                case '\xB9':
-                case '\xBA':
-                case '\xBB':
-                case '\xBC':
-                case '\xBD':
-                case '\xBE':
-                case '\xBF': {
-                    current_background_color = Palette::getAnsiColor(static_cast<typename Palette::Ansi>(*text));
-                    continue;
-                }
+    /// @brief Draw text decoded in advance at specified position
+    /// @param run Text decoded with current font (runs of other fonts are not drawn)
+    /// @details Same layout as text(const char *), without per-draw decoding and glyph lookup.
+    void text(Pixel start_x, Pixel start_y, const TextRun &run) noexcept {
+        if (&run.font() != current_font) { return; }
 
-                case '\n': {
-                    clearLineSegment(cursor_x, cursor_y, maxX(), current_background_color);
-                    cursor_x = start_x;
-                    cursor_y = static_cast<Pixel>(cursor_y + font_total_height);
-                    continue;
-                }
+        TextCursor cursor{start_x, start_x, start_y, foreground_color, background_color, TextMode::Flow};
 
-                case '\t': {
-                    const auto tab_width = tabWidth();
-                    const auto new_x = static_cast<Pixel>(((cursor_x / tab_width) + 1) * tab_width);
-                    clearLineSegment(cursor_x, cursor_y, new_x, current_background_color);
-                    cursor_x = new_x;
-                    continue;
-                }
+        for (const auto token: run) {
+            if (not textToken(cursor, token)) { return; }
+        }
+    }
+
+    /// @brief Draw laid out text, each line aligned on anchor
+    /// @param anchor_x Left edge, center or right edge of lines (see align)
+    /// @param top Top of first line
+    /// @param layout Layout of run decoded with current font (other layouts are not drawn)
+    /// @param align Horizontal alignment of lines
+    /// @details Lines are drawn as broken by layout(): no wrapping, no clearing beyond line ends,
+    /// glyphs outside the canvas are clipped. Tab stops are relative to line start.
+    void text(Pixel anchor_x, Pixel top, const TextLayout &layout, TextAlign align = TextAlign::Left) noexcept {
+        if (nullptr == layout.run() or &layout.run()->font() != current_font) { return; }
+
+        const u16 *tokens = layout.run()->begin();
+        TextCursor cursor{anchor_x, anchor_x, top, foreground_color, background_color, TextMode::Place};
+
+        for (const auto &line: layout) {
+            Pixel line_x = anchor_x;
+            if (align == TextAlign::Center) {
+                line_x = static_cast<Pixel>(anchor_x - line.width / 2);
+            } else if (align == TextAlign::Right) {
+                line_x = static_cast<Pixel>(anchor_x - line.width);
             }
 
-            if (cursor_x > static_cast<Pixel>(width() - font_width)) {
-                clearLineSegment(cursor_x, cursor_y, maxX(), current_background_color);
-                if (auto_next_line) {
-                    cursor_x = start_x;
-                    cursor_y = static_cast<Pixel>(cursor_y + font_total_height);
-                } else {
+            cursor.start_x = line_x;
+            cursor.x = line_x;
+
+            for (u16 i = 0; i < line.count; i += 1) {
+                (void) textToken(cursor, tokens[line.first + i]);
+            }
+
+            cursor.y = static_cast<Pixel>(cursor.y + glyphHeight());
+        }
+    }
+
+    // Numbers
+
+    /// @brief Maximum number of glyph cells drawn by number() (any 64-bit value with sign and decimal point)
+    static constexpr u8 max_number_cells = 21;
+
+    /// @brief Cells of number last drawn at a position, lets number() redraw only changed glyphs
+    /// @details Any change of position, font, text scale, colors or cell count redraws all cells.
+    struct NumberCache {
+        u16 cells[max_number_cells]{};///< Glyph tokens of drawn cells
+        u8 count{0};                  ///< Number of drawn cells (0 - nothing drawn)
+        Pixel x{0};                   ///< Drawn position
+        Pixel y{0};                   ///< Drawn position
+        Pixel end_x{0};               ///< Right end of drawn cells
+        const Font *font{nullptr};    ///< Font of cells
+        u8 scale{0};                  ///< Text scale of cells
+        ColorType foreground{};       ///< Text color of cells
+        ColorType background{};       ///< Background color of cells
+
+        /// @brief Force full redraw on next use (e.g. after area was overdrawn)
+        void invalidate() noexcept { count = 0; }
+    };
+
+    /// @brief Draw integer or fixed-point number without string formatting
+    /// @tparam T Any integer type except bool
+    /// @param x Left position
+    /// @param y Top position
+    /// @param value Number, in units of 10^-places when places > 0 (1234 with 2 places is "12.34")
+    /// @param min_cells Minimal number of cells, number is right aligned with spaces
+    /// @param places Digits after decimal point (0-9)
+    /// @param cache Cells of previous number drawn here (nullptr - draw all cells)
+    /// @details Digits are generated in reverse straight into glyph tokens and drawn as text
+    /// (current colors, text scale and clipping). With cache, only cells whose glyph changed are drawn;
+    /// proportional fonts redraw everything after the first changed cell.
+    template<typename T, typename = std::enable_if_t<std::is_integral<T>::value and not std::is_same<T, bool>::value>>
+    void number(Pixel x, Pixel y, T value, u8 min_cells = 0, u8 places = 0, NumberCache *cache = nullptr) noexcept {
+        bool negative = false;
+        if constexpr (std::is_signed<T>::value) { negative = value < 0; }
+
+        const auto magnitude = static_cast<u64>(value);
+        drawNumber(x, y, negative, negative ? u64{0} - magnitude : magnitude, min_cells, places, cache);
+    }
+
+    /// @brief Draw real number rounded to fixed-point (see number(Pixel, Pixel, T, u8, u8, NumberCache *))
+    /// @details Converted with one multiplication by 10^places, no per-digit floating point math.
+    void number(Pixel x, Pixel y, f32 value, u8 min_cells = 0, u8 places = 0, NumberCache *cache = nullptr) noexcept {
+        number(x, y, toFixed(static_cast<f64>(value), places), min_cells, places, cache);
+    }
+
+    /// @brief Draw real number rounded to fixed-point (see number(Pixel, Pixel, T, u8, u8, NumberCache *))
+    void number(Pixel x, Pixel y, f64 value, u8 min_cells = 0, u8 places = 0, NumberCache *cache = nullptr) noexcept {
+        number(x, y, toFixed(value, places), min_cells, places, cache);
+    }
+
+    // Text measurement
+
+    /// @brief Measure text as text(0, 0, text) lays it out, without drawing
+    /// @details Understands control sequences, tabs and new lines. Lines wrap at canvas width
+    /// when auto next line is enabled, otherwise they are measured in full (not cut at the edge).
+    /// @return Widest line width, height of all lines and line count (zeros for empty text)
+    kf_nodiscard TextExtent measure(const char *text) noexcept {
+        return layoutTokens(
+            [this, &text]() { return TextRun::next(*current_font, text); },
+            [](usize, usize, Pixel) { return true; });
+    }
+
+    /// @brief Measure text run decoded with current font (see measure(const char *))
+    kf_nodiscard TextExtent measure(const TextRun &run) noexcept {
+        if (&run.font() != current_font) { return {}; }
+
+        auto token = run.begin();
+        return layoutTokens(
+            [&token, &run]() { return (token == run.end()) ? u16{TextRun::End} : *token++; },
+            [](usize, usize, Pixel) { return true; });
+    }
+
+    /// @brief Break text run into lines for current font, text scale and wrapping
+    /// @param run Text decoded with current font (must outlive layout)
+    /// @param layout Layout to fill, reusable across frames while font, scale and run stay the same
+    /// @return false if run font differs or layout has too few line slots (extent still covers all lines)
+    kf_nodiscard bool layout(const TextRun &run, TextLayout &layout) noexcept {
+        layout.source = &run;
+        layout.line_count = 0;
+        layout.box = {};
+
+        if (&run.font() != current_font or run.size() > 0xFFFF) { return false; }
+
+        bool complete = true;
+        auto token = run.begin();
+
+        layout.box = layoutTokens(
+            [&token, &run]() { return (token == run.end()) ? u16{TextRun::End} : *token++; },
+            [&layout, &complete](usize first, usize last, Pixel line_width) {
+                if (layout.line_count == layout.storage.size()) {
+                    complete = false;
                     return;
                 }
+
+                layout.storage[layout.line_count] = {
+                    static_cast<u16>(first),
+                    static_cast<u16>(last - first),
+                    line_width,
+                };
+                layout.line_count += 1;
+            });
+
+        return complete;
+    }
+
+private:
+    // Drawing API backend
+
+    /// @brief Largest supported number of decimal places
+    static constexpr u8 max_number_places = 9;
+
+    /// @brief Round real number to fixed-point with places decimals, saturating to i32
+    kf_nodiscard static i32 toFixed(f64 value, u8 places) noexcept {
+        constexpr f64 scales[max_number_places + 1] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+
+        const auto scaled = value * scales[kf::min(places, max_number_places)];
+        if (scaled != scaled) { return 0; }// NaN
+        if (scaled <= -2147483648.0) { return i32{-0x7FFFFFFF - 1}; }
+        if (scaled >= 2147483647.0) { return 0x7FFFFFFF; }
+
+        return static_cast<i32>(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+    }
+
+    /// @brief Draw number from sign and magnitude (see number())
+    void drawNumber(Pixel x, Pixel y, bool negative, u64 magnitude, u8 min_cells, u8 places, NumberCache *cache) noexcept {
+        u16 tokens[max_number_cells];
+        const auto count = numberCells(tokens, negative, magnitude, min_cells, places);
+
+        TextCursor cursor{x, x, y, foreground_color, background_color, TextMode::Flow};
+
+        const bool reuse = nullptr != cache and cache->count == count and cache->x == x and cache->y == y
+            and cache->font == current_font and cache->scale == text_scale
+            and cache->foreground == foreground_color and cache->background == background_color;
+
+        bool redraw_rest = not reuse;
+        for (u8 i = 0; i < count; i += 1) {
+            const bool changed = redraw_rest or cache->cells[i] != tokens[i];
+            if (changed and current_font->isProportional()) { redraw_rest = true; }
+
+            // Unchanged cells are only stepped over
+            cursor.mode = changed ? TextMode::Flow : TextMode::Measure;
+            if (not textToken(cursor, tokens[i])) { break; }
+        }
+
+        if (nullptr == cache) { return; }
+
+        // Clear leftovers of longer previous number
+        if (cache->count != 0 and cache->x == x and cache->y == y and cache->end_x > cursor.x) {
+            fillRect(
+                cursor.x, y,
+                static_cast<Pixel>(cache->end_x - 1), static_cast<Pixel>(y + glyphHeight() - 1),
+                background_color);
+        }
+
+        for (u8 i = 0; i < count; i += 1) { cache->cells[i] = tokens[i]; }
+        cache->count = count;
+        cache->x = x;
+        cache->y = y;
+        cache->end_x = cursor.x;
+        cache->font = current_font;
+        cache->scale = text_scale;
+        cache->foreground = foreground_color;
+        cache->background = background_color;
+    }
+
+    /// @brief Glyph token of ASCII character in current font
+    kf_nodiscard u16 charToken(char c) const noexcept {
+        const auto index = current_font->glyphIndex(static_cast<u8>(c));
+        return (index < 0) ? u16{TextRun::Missing} : static_cast<u16>(index);
+    }
+
+    /// @brief Fill glyph tokens of right aligned fixed-point number
+    /// @return Number of cells (at most max_number_cells, excess leading cells dropped)
+    u8 numberCells(u16 (&cells)[max_number_cells], bool negative, u64 magnitude, u8 min_cells, u8 places) const noexcept {
+        places = kf::min(places, max_number_places);
+
+        u16 digit_tokens[10];
+        for (u8 d = 0; d < 10; d += 1) { digit_tokens[d] = charToken(static_cast<char>('0' + d)); }
+
+        // Reverse digit generation, decimal point after `places` digits, at least one integer digit
+        u16 reversed[max_number_cells];
+        u8 length = 0;
+        u8 digits = 0;
+
+        do {
+            reversed[length] = digit_tokens[magnitude % 10];
+            length += 1;
+            magnitude /= 10;
+            digits += 1;
+
+            if (digits == places) {
+                reversed[length] = charToken('.');
+                length += 1;
             }
+        } while ((magnitude != 0 or digits <= places) and length < max_number_cells);
+
+        if (negative and length < max_number_cells) {
+            reversed[length] = charToken('-');
+            length += 1;
+        }
 
-            if (cursor_y > static_cast<Pixel>(height() - font_height)) { return; }
+        const u8 total = kf::max(length, kf::min(min_cells, max_number_cells));
+        const u16 space = charToken(' ');
 
-            drawGlyph(cursor_x, cursor_y, current_font->getGlyph(*text), current_foreground_color, current_background_color);
+        u8 count = 0;
+        for (; count < total - length; count += 1) { cells[count] = space; }
+        for (u8 i = length; i > 0; i -= 1, count += 1) { cells[count] = reversed[i - 1]; }
 
-            cursor_x = static_cast<Pixel>(cursor_x + font_width);
-            if (cursor_x < width()) {
-                drawLineVertical(
-                    cursor_x,
-                    cursor_y,
-                    static_cast<Pixel>(cursor_y + font_height),
-                    current_background_color);
+        return count;
+    }
+
+    /// @brief Text layout pass
+    enum class TextMode : u8 {
+        Flow,   ///< Draw, wrapping or stopping at canvas edges and clearing line remainders (text())
+        Measure,///< Lay out without drawing
+        Place,  ///< Draw lines already broken by layout()
+    };
+
+    /// @brief Text layout state
+    struct TextCursor {
+        Pixel start_x;        ///< Line start position
+        Pixel x;              ///< Current position
+        Pixel y;              ///< Current line top
+        ColorType foreground; ///< Current text color
+        ColorType background; ///< Current background color
+        TextMode mode;        ///< Layout pass
+    };
+
+    /// @brief Lay out tokens without drawing, starting at (0, 0)
+    /// @param next Token source, returns TextRun::End after last token
+    /// @param on_line Called with (first token index, index past last token, line width) per line
+    template<typename Next, typename OnLine> TextExtent layoutTokens(Next next, OnLine on_line) noexcept {
+        TextCursor cursor{0, 0, 0, foreground_color, background_color, TextMode::Measure};
+        TextExtent extent{};
+
+        usize first = 0;
+        usize index = 0;
+
+        for (auto token = next(); token != TextRun::End; token = next(), index += 1) {
+            const auto line_width = cursor.x;
+            const auto line_y = cursor.y;
+
+            (void) textToken(cursor, token);
+
+            if (cursor.y != line_y) {
+                on_line(first, index, line_width);
+                extent.width = kf::max(extent.width, line_width);
+                extent.lines += 1;
+
+                // Line feed ends line, wrapped glyph starts next one
+                first = (token == TextRun::NewLine) ? index + 1 : index;
             }
-            cursor_x = static_cast<Pixel>(cursor_x + 1);
         }
+
+        if (index == 0) { return {}; }
+
+        on_line(first, index, cursor.x);
+        extent.width = kf::max(extent.width, cursor.x);
+        extent.lines += 1;
+        extent.height = static_cast<Pixel>(extent.lines * glyphHeight());
+        return extent;
     }
 
-private:
-    // Drawing API backend
+    /// @brief Lay out and draw one text token (glyph index or TextRun token)
+    /// @return false when text ran out of canvas
+    kf_nodiscard bool textToken(TextCursor &cursor, u16 token) noexcept {
+        const bool render = cursor.mode != TextMode::Measure;
+        const bool flow = cursor.mode == TextMode::Flow;
+
+        const auto font_height = static_cast<Pixel>(current_font->glyph_height * text_scale);
+        const auto line_height = glyphHeight();
+
+        switch (token) {
+            case TextRun::Normal: {
+                cursor.foreground = foreground_color;
+                cursor.background = background_color;
+                return true;
+            }
 
-    /// @brief Clear rectangular line segment with background color
+            case TextRun::Invert: {
+                cursor.foreground = background_color;
+                cursor.background = foreground_color;
+                return true;
+            }
+
+            case TextRun::Swap: {
+                std::swap(cursor.foreground, cursor.background);
+                return true;
+            }
+
+            case TextRun::NewLine: {
+                if (flow) { clearLineSegment(cursor.x, cursor.y, maxX(), cursor.background); }
+                cursor.x = cursor.start_x;
+                cursor.y = static_cast<Pixel>(cursor.y + line_height);
+                return true;
+            }
+
+            case TextRun::Tab: {
+                // Tab stops are canvas columns for flowing text, line offsets otherwise
+                const auto tab_width = tabWidth();
+                const auto origin = flow ? Pixel{0} : cursor.start_x;
+                const auto new_x = static_cast<Pixel>(origin + ((cursor.x - origin) / tab_width + 1) * tab_width);
+                if (render) { clearLineSegment(cursor.x, cursor.y, static_cast<Pixel>(new_x - 1), cursor.background); }
+                cursor.x = new_x;
+                return true;
+            }
+
+            default: break;
+        }
+
+        switch (token & 0xFFF0) {
+            case TextRun::Foreground: {
+                cursor.foreground = Palette::getAnsiColor(static_cast<typename Palette::Ansi>(token & 0xF));
+                return true;
+            }
+
+            case TextRun::Background: {
+                cursor.background = Palette::getAnsiColor(static_cast<typename Palette::Ansi>(token & 0xF));
+                return true;
+            }
+
+            default: break;
+        }
+
+        const auto glyph = current_font->glyphAt((token == TextRun::Missing) ? -1 : i32{token});
+        const auto glyph_width = static_cast<Pixel>(glyph.width * text_scale);
+
+        if (cursor.mode != TextMode::Place and cursor.x > static_cast<Pixel>(width() - glyph_width)) {
+            if (flow) { clearLineSegment(cursor.x, cursor.y, maxX(), cursor.background); }
+
+            if (auto_next_line) {
+                cursor.x = cursor.start_x;
+                cursor.y = static_cast<Pixel>(cursor.y + line_height);
+            } else if (flow) {
+                return false;
+            }
+        }
+
+        if (not render) {
+            cursor.x = static_cast<Pixel>(cursor.x + glyph_width + text_scale);
+            return true;
+        }
+
+        if (flow and cursor.y > static_cast<Pixel>(height() - font_height)) { return false; }
+
+        drawGlyph(cursor.x, cursor.y, glyph, cursor.foreground, cursor.background);
+
+        // Inter-glyph spacing column
+        cursor.x = static_cast<Pixel>(cursor.x + glyph_width);
+        fillRect(
+            cursor.x, cursor.y,
+            static_cast<Pixel>(cursor.x + text_scale - 1), static_cast<Pixel>(cursor.y + line_height - 1),
+            cursor.background);
+        cursor.x = static_cast<Pixel>(cursor.x + text_scale);
+        return true;
+    }
+
+    /// @brief Clear text line segment [cursor_x, end_x] with background color
     void clearLineSegment(Pixel cursor_x, Pixel cursor_y, Pixel end_x, ColorType color) noexcept {
-        if (cursor_x < end_x) {
-            frame.fill(
+        if (cursor_x <= end_x) {
+            fillRect(
                 cursor_x, cursor_y,
-                end_x, current_font->heightTotal() + cursor_y,
+                end_x, static_cast<Pixel>(glyphHeight() + cursor_y - 1),
                 color
             );
         }
@@ -450,60 +1206,269 @@ private:
         if (x0 > x1) {
             std::swap(x0, x1);
         }
-        frame.fill(x0, y, x1, y, color);
+        fillRect(x0, y, x1, y, color);
     }
 
     /// @brief Draw vertical line (optimized)
     void drawLineVertical(Pixel x, Pixel y0, Pixel y1, ColorType color) const noexcept {
         if (y0 > y1) { std::swap(y0, y1); }
-        frame.fill(x, y0, x, y1, color);
+        fillRect(x, y0, x, y1, color);
+    }
+
+    /// @brief Clipping rectangle covering whole canvas
+    kf_nodiscard ClipRect fullClip() const noexcept { return {0, 0, maxX(), maxY()}; }
+
+    /// @brief View of frame restricted to current clipping rectangle (clip must be non-empty)
+    kf_nodiscard DynamicImage<F> clipFrame() noexcept {
+        return frame.subUnchecked(
+            static_cast<Pixel>(clip.x1 - clip.x0 + 1),
+            static_cast<Pixel>(clip.y1 - clip.y0 + 1),
+            clip.x0, clip.y0);
+    }
+
+    /// @brief Fill rectangle [x0, x1] x [y0, y1] clipped to current clipping rectangle
+    void fillRect(Pixel x0, Pixel y0, Pixel x1, Pixel y1, ColorType color) const noexcept {
+        x0 = kf::max(x0, clip.x0);
+        y0 = kf::max(y0, clip.y0);
+        x1 = kf::min(x1, clip.x1);
+        y1 = kf::min(y1, clip.y1);
+
+        if (x0 > x1 or y0 > y1) { return; }
+        frame.fill(x0, y0, x1, y1, color);
+    }
+
+    /// @brief Draw horizontal span [x0, x1] on row y
+    /// @param clipped false if span is known to be visible (skips clipping)
+    inline void drawSpan(Pixel x0, Pixel x1, Pixel y, ColorType color, bool clipped = true) const noexcept {
+        if (clipped) {
+            fillRect(x0, y, x1, y, color);
+        } else {
+            frame.fill(x0, y, x1, y, color);
+        }
+    }
+
+    /// @brief Cohen–Sutherland region code of point relative to clipping rectangle
+    kf_nodiscard u8 outCode(Pixel x, Pixel y) const noexcept {
+        u8 code = 0;
+        if (x < clip.x0) { code |= 0b0001; }
+        if (x > clip.x1) { code |= 0b0010; }
+        if (y < clip.y0) { code |= 0b0100; }
+        if (y > clip.y1) { code |= 0b1000; }
+        return code;
+    }
+
+    /// @brief Range of Bresenham steps along major axis that land inside clipping bounds
+    /// @details Minor coordinate after step k is minor0 + minor_sign * floor((2 * k * minor_delta + major_delta) / (2 * major_delta)),
+    /// the exact sequence produced by line(), so range is solved analytically instead of walked.
+    /// @param first First visible step (in/out, initially 0)
+    /// @param last Last visible step (in/out, initially major_delta)
+    /// @return false if no step is visible
+    static bool visibleSteps(
+        i32 major0, i32 minor0,
+        i32 major_delta, i32 minor_delta,
+        i32 major_sign, i32 minor_sign,
+        i32 major_low, i32 major_high,
+        i32 minor_low, i32 minor_high,
+        i32 &first, i32 &last
+    ) noexcept {
+        // Major axis bounds as step offsets
+        const i32 major_begin = (major_sign > 0) ? major_low - major0 : major0 - major_high;
+        const i32 major_end = (major_sign > 0) ? major_high - major0 : major0 - major_low;
+
+        // Minor axis bounds as minor offsets, mapped back to steps
+        const i64 minor_begin = (minor_sign > 0) ? minor_low - minor0 : minor0 - minor_high;
+        const i64 minor_end = (minor_sign > 0) ? minor_high - minor0 : minor0 - minor_low;
+
+        const auto ceilDiv = [](i64 a, i64 b) { return (a >= 0) ? (a + b - 1) / b : -(-a / b); };
+        const i64 step_begin = ceilDiv(major_delta * (2 * minor_begin - 1), 2 * i64{minor_delta});
+        const i64 step_end = ceilDiv(major_delta * (2 * minor_end + 1), 2 * i64{minor_delta}) - 1;
+
+        first = static_cast<i32>(kf::max<i64>(kf::max<i64>(first, major_begin), step_begin));
+        last = static_cast<i32>(kf::min<i64>(kf::min<i64>(last, major_end), step_end));
+        return first <= last;
+    }
+
+    /// @brief Draw mirrored ellipse row spans |x| in [start, outer]
+    /// @details Left half is mirrored around left_cx, right half around right_cx,
+    /// upper row is top_cy - dy, lower row is bottom_cy + dy. Distinct centers stretch
+    /// the ellipse into a rounded rectangle (start == 0 also fills the part between centers).
+    void drawMirroredSpans(
+        Pixel left_cx, Pixel right_cx,
+        Pixel top_cy, Pixel bottom_cy,
+        Pixel dy, Pixel start, Pixel outer,
+        bool clipped
+    ) const noexcept {
+        const auto draw_row = [&](Pixel y) {
+            if (start == 0) {
+                drawSpan(static_cast<Pixel>(left_cx - outer), static_cast<Pixel>(right_cx + outer), y, foreground_color, clipped);
+            } else {
+                drawSpan(static_cast<Pixel>(left_cx - outer), static_cast<Pixel>(left_cx - start), y, foreground_color, clipped);
+                drawSpan(static_cast<Pixel>(right_cx + start), static_cast<Pixel>(right_cx + outer), y, foreground_color, clipped);
+            }
+        };
+
+        const auto upper = static_cast<Pixel>(top_cy - dy);
+        const auto lower = static_cast<Pixel>(bottom_cy + dy);
+
+        draw_row(upper);
+        if (lower != upper) {
+            draw_row(lower);
+        }
     }
 
-    /// @brief Draw 8 symmetric points for circle outline
-    void drawCirclePoints(Pixel cx, Pixel cy, Pixel dx, Pixel dy, ColorType color) const noexcept {
-        frame.setPixel(static_cast<Pixel>(cx + dx), static_cast<Pixel>(cy + dy), color);
-        frame.setPixel(static_cast<Pixel>(cx + dy), static_cast<Pixel>(cy + dx), color);
-        frame.setPixel(static_cast<Pixel>(cx - dy), static_cast<Pixel>(cy + dx), color);
-        frame.setPixel(static_cast<Pixel>(cx - dx), static_cast<Pixel>(cy + dy), color);
-        frame.setPixel(static_cast<Pixel>(cx - dx), static_cast<Pixel>(cy - dy), color);
-        frame.setPixel(static_cast<Pixel>(cx - dy), static_cast<Pixel>(cy - dx), color);
-        frame.setPixel(static_cast<Pixel>(cx + dy), static_cast<Pixel>(cy - dx), color);
-        frame.setPixel(static_cast<Pixel>(cx + dx), static_cast<Pixel>(cy - dy), color);
+    /// @brief Walk ellipse quadrant rows with midpoint rule, integer only
+    /// @details For each row offset dy in [0, ry] calls row(dy, outer, inner), where outer is
+    /// the half-width of the filled ellipse on this row and inner is the first outline column
+    /// (outline pixels of the row are |x| in [inner, outer], keeping the outline connected).
+    /// Pixel (x, y) is inside when (x / (rx + 0.5))^2 + (y / (ry + 0.5))^2 <= 1.
+    template<typename RowHandler> static void forEachEllipseRow(Pixel rx, Pixel ry, RowHandler &&row) noexcept {
+        const i64 a = 2 * rx + 1;
+        const i64 b = 2 * ry + 1;
+        const i64 a2 = a * a;
+        const i64 b2 = b * b;
+        const i64 limit = a2 * b2;
+
+        const auto inside = [&](i64 x, i64 y) { return 4 * (x * x * b2 + y * y * a2) <= limit; };
+
+        Pixel outer = rx;
+        for (Pixel dy = 0; dy <= ry; dy += 1) {
+            while (outer > 0 and not inside(outer, dy)) { outer -= 1; }
+
+            // Half-width of the next row bounds the outline segment of this row
+            Pixel next = outer;
+            if (dy == ry) {
+                next = -1;
+            } else {
+                while (next >= 0 and not inside(next, dy + 1)) { next -= 1; }
+            }
+
+            row(dy, outer, static_cast<Pixel>(kf::min<Pixel>(static_cast<Pixel>(next + 1), outer)));
+        }
     }
 
     /// @brief Draw font glyph at specified position
     /// @param x Left position
     /// @param y Top position
-    /// @param glyph Pointer to glyph bitmap data
+    /// @param glyph Glyph bitmap (page layout, any height) and width
     /// @param color_on Color for "on" pixels
-    void drawGlyph(Pixel x, Pixel y, const u8 *glyph, ColorType color_on, ColorType color_off) noexcept {
-        if (nullptr == glyph) {
+    void drawGlyph(Pixel x, Pixel y, const Font::Glyph &glyph, ColorType color_on, ColorType color_off) noexcept {
+        if (nullptr == glyph.bitmap) {
             // Draw box for unknown character
-            const auto x1 = static_cast<Pixel>(x + current_font->glyph_width - 1);
-            const auto y1 = static_cast<Pixel>(y + current_font->glyph_height - 1);
+            const auto x1 = static_cast<Pixel>(x + glyph.width * text_scale - 1);
+            const auto y1 = static_cast<Pixel>(y + current_font->glyph_height * text_scale - 1);
+
+            if (text_scale == 1) {
+                drawLineHorizontal(x, y, x1, color_on);
+                drawLineHorizontal(x, y1, x1, color_on);
+                drawLineVertical(x, y, y1, color_on);
+                drawLineVertical(x1, y, y1, color_on);
+                return;
+            }
+
+            // Lines as thick as magnified glyph pixels
+            const auto inner_x1 = static_cast<Pixel>(x1 - text_scale + 1);
+            const auto inner_y1 = static_cast<Pixel>(y1 - text_scale + 1);
+            fillRect(x, y, x1, static_cast<Pixel>(y + text_scale - 1), color_on);
+            fillRect(x, inner_y1, x1, y1, color_on);
+            fillRect(x, y, static_cast<Pixel>(x + text_scale - 1), y1, color_on);
+            fillRect(inner_x1, y, x1, y1, color_on);
+            return;
+        }
 
-            drawLineHorizontal(x, y, x1, color_on);
-            drawLineHorizontal(x, y1, x1, color_on);
-            drawLineVertical(x, y, y1, color_on);
-            drawLineVertical(x1, y, y1, color_on);
+        if (text_scale > 1) {
+            drawGlyphScaled(x, y, glyph, color_on, color_off);
             return;
         }
 
-        const u8 font_width = current_font->glyph_width;
+        const u8 font_width = glyph.width;
         const u8 font_height = current_font->glyph_height;
 
-        for (u8 col = 0; col < font_width; ++col) {
-            const auto pixel_x = static_cast<Pixel>(x + col);
-            const u8 glyph_byte = glyph[col];
+        const auto right = static_cast<Pixel>(x + font_width - 1);
+        const auto bottom = static_cast<Pixel>(y + font_height - 1);
 
-            for (u8 row = 0; row < font_height; row += 1) {
-                const auto color = (glyph_byte >> row) & 1 ? color_on : color_off;
-                frame.setPixel(pixel_x, static_cast<Pixel>(y + row), color);
+        // Inter-line spacing row
+        drawSpan(x, right, static_cast<Pixel>(bottom + 1), color_off);
+
+        // Glyphs outside clipping rectangle never reach the cache
+        const bool visible = clip.contains(x, y, right, bottom);
+        if (not visible and (clip.isEmpty() or x > clip.x1 or y > clip.y1 or right < clip.x0 or bottom < clip.y0)) { return; }
+
+        const auto *cached = (nullptr == glyph_cache) ? nullptr : glyph_cache->get(*current_font, glyph, color_on, color_off);
+
+        const auto draw = [&](const auto &target, Pixel target_x, Pixel target_y) {
+            if (nullptr != cached) {
+                target.copy(target_x, target_y, cached, font_width, font_height);
+            } else {
+                // Glyph columns share page layout with monochrome frames: written as whole bytes there
+                target.bitmap(target_x, target_y, glyph.bitmap, font_width, font_height, color_on, color_off);
             }
+        };
+
+        // Partially visible glyphs are drawn into view of clipping rectangle
+        if (visible) {
+            draw(frame, x, y);
+        } else {
+            draw(clipFrame(), static_cast<Pixel>(x - clip.x0), static_cast<Pixel>(y - clip.y0));
+        }
+    }
+
+    /// @brief Draw glyph magnified by text scale
+    /// @details Runs of equal bits in a column become one fill, and identical adjacent
+    /// columns share it, so a glyph costs a few clipped fills (whole page bytes on monochrome
+    /// frames, row spans on RGB565) instead of a fill per magnified pixel.
+    void drawGlyphScaled(Pixel x, Pixel y, const Font::Glyph &glyph, ColorType color_on, ColorType color_off) noexcept {
+        const u8 scale = text_scale;
+        const u8 font_height = current_font->glyph_height;
+        const u8 pages = current_font->pages();
+        const u8 *bitmap = glyph.bitmap;
+
+        const auto right = static_cast<Pixel>(x + glyph.width * scale - 1);
+        const auto bottom = static_cast<Pixel>(y + (font_height + 1) * scale - 1);
+        if (x > clip.x1 or y > clip.y1 or right < clip.x0 or bottom < clip.y0) { return; }
+
+        const auto column_equals = [bitmap, pages, &glyph](u8 a, u8 b) {
+            for (u8 page = 0; page < pages; page += 1) {
+                if (bitmap[page * glyph.width + a] != bitmap[page * glyph.width + b]) { return false; }
+            }
+            return true;
+        };
 
-            frame.setPixel(pixel_x, static_cast<Pixel>(y + font_height), color_off);
+        const auto bit = [bitmap, &glyph](u8 column, u8 row) {
+            return ((bitmap[(row / 8) * glyph.width + column] >> (row % 8)) & 1) != 0;
+        };
+
+        u8 column = 0;
+        while (column < glyph.width) {
+            u8 column_end = static_cast<u8>(column + 1);
+            while (column_end < glyph.width and column_equals(column, column_end)) { column_end += 1; }
+
+            const auto x0 = static_cast<Pixel>(x + column * scale);
+            const auto x1 = static_cast<Pixel>(x + column_end * scale - 1);
+
+            u8 run_start = 0;
+            bool run_bit = bit(column, 0);
+            for (u8 row = 1; row <= font_height; row += 1) {
+                const bool row_bit = (row < font_height) and bit(column, row);
+                if (row == font_height or row_bit != run_bit) {
+                    fillRect(
+                        x0, static_cast<Pixel>(y + run_start * scale),
+                        x1, static_cast<Pixel>(y + row * scale - 1),
+                        run_bit ? color_on : color_off);
+                    run_start = row;
+                    run_bit = row_bit;
+                }
+            }
+
+            column = column_end;
         }
+
+        // Inter-line spacing rows
+        fillRect(x, static_cast<Pixel>(y + font_height * scale), right, bottom, color_off);
     }
 };
 
+/// @brief Canvas over whole frame buffer of compile-time size (e.g. display buffer, see DisplayDriver::staticFrame)
+/// @details Drawing code is shared with Canvas<F>, view address math and bounds are constants.
+template<PixelFormat F, Pixel W, Pixel H> using StaticCanvas = Canvas<F, StaticFrame<F, W, H>>;
+
 }// namespace kf::gfx
@@ -37,23 +37,23 @@ private:
 
     static constexpr ColorType ansi_colors[16]{
         // standard
-        traits::fromRgb(0x00, 0x00, 0x00), // black
-        traits::fromRgb(0x80, 0x00, 0x00), // red
-        traits::fromRgb(0x00, 0x80, 0x00), // green
-        traits::fromRgb(0x80, 0x80, 0x00), // yellow
-        traits::fromRgb(0x00, 0x00, 0x80), // blue
-        traits::fromRgb(0x80, 0x00, 0x80), // purple
-        traits::fromRgb(0x00, 0x60, 0x60), // cyan
-        traits::fromRgb(0x80, 0x80, 0x80), // white
+        traits::fromRgb(ansi_rgb[0x0][0], ansi_rgb[0x0][1], ansi_rgb[0x0][2]), // black
+        traits::fromRgb(ansi_rgb[0x1][0], ansi_rgb[0x1][1], ansi_rgb[0x1][2]), // red
+        traits::fromRgb(ansi_rgb[0x2][0], ansi_rgb[0x2][1], ansi_rgb[0x2][2]), // green
+        traits::fromRgb(ansi_rgb[0x3][0], ansi_rgb[0x3][1], ansi_rgb[0x3][2]), // yellow
+        traits::fromRgb(ansi_rgb[0x4][0], ansi_rgb[0x4][1], ansi_rgb[0x4][2]), // blue
+        traits::fromRgb(ansi_rgb[0x5][0], ansi_rgb[0x5][1], ansi_rgb[0x5][2]), // purple
+        traits::fromRgb(ansi_rgb[0x6][0], ansi_rgb[0x6][1], ansi_rgb[0x6][2]), // cyan
+        traits::fromRgb(ansi_rgb[0x7][0], ansi_rgb[0x7][1], ansi_rgb[0x7][2]), // white
         // intense
-        traits::fromRgb(0x30, 0x30, 0x30), // bright black
-        traits::fromRgb(0xFF, 0x20, 0x20), // bright red
-        traits::fromRgb(0x20, 0xCF, 0x20), // bright green
-        traits::fromRgb(0xFF, 0xFF, 0x00), // bright yellow
-        traits::fromRgb(0x20, 0x20, 0xFF), // bright blue
-        traits::fromRgb(0xFF, 0x20, 0xFF), // bright purple
-        traits::fromRgb(0x00, 0xDF, 0xCF), // bright cyan
-        traits::fromRgb(0xFF, 0xFF, 0xFF), // bright white
+        traits::fromRgb(ansi_rgb[0x8][0], ansi_rgb[0x8][1], ansi_rgb[0x8][2]), // bright black
+        traits::fromRgb(ansi_rgb[0x9][0], ansi_rgb[0x9][1], ansi_rgb[0x9][2]), // bright red
+        traits::fromRgb(ansi_rgb[0xA][0], ansi_rgb[0xA][1], ansi_rgb[0xA][2]), // bright green
+        traits::fromRgb(ansi_rgb[0xB][0], ansi_rgb[0xB][1], ansi_rgb[0xB][2]), // bright yellow
+        traits::fromRgb(ansi_rgb[0xC][0], ansi_rgb[0xC][1], ansi_rgb[0xC][2]), // bright blue
+        traits::fromRgb(ansi_rgb[0xD][0], ansi_rgb[0xD][1], ansi_rgb[0xD][2]), // bright purple
+        traits::fromRgb(ansi_rgb[0xE][0], ansi_rgb[0xE][1], ansi_rgb[0xE][2]), // bright cyan
+        traits::fromRgb(ansi_rgb[0xF][0], ansi_rgb[0xF][1], ansi_rgb[0xF][2]), // bright white
     };
 
 public:
@@ -63,4 +63,14 @@ public:
     }
 };
 
+static_assert(
+    [] {
+        using Palette = ColorPalette<PixelFormat::Indexed4>;
+        for (u8 i = 0; i < 16; i += 1) {
+            if (Palette::getAnsiColor(static_cast<Palette::Ansi>(i)) != i) { return false; }
+        }
+        return true;
+    }(),
+    "ANSI colors must map to Indexed4 default palette indices");
+
 }
\ No newline at end of file
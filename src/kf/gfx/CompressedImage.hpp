@@ -0,0 +1,44 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/core/pixel_traits.hpp"
+#include "kf/math/units.hpp"
+
+namespace kf::gfx {
+
+/// @brief Predefined compressed image with compile-time dimensions
+/// @tparam Format Pixel format for the image
+/// @tparam W Image width in pixels
+/// @tparam H Image height in pixels
+/// @tparam N Compressed stream length in buffer elements
+/// @details Stream encoding is defined by pixel_traits<Format>::decode:
+/// RLE of pixels for RGB565, page-wise packbits for monochrome.
+/// Canvas decodes it straight into the frame, runs become fills.
+/// Generate with tools/compress_image.py.
+template<PixelFormat Format, Pixel W, Pixel H, usize N> struct CompressedImage final {
+private:
+    using Traits = pixel_traits<Format>;
+
+public:
+    /// @brief Get the image width
+    kf_nodiscard inline constexpr Pixel width() const { return W; }
+
+    /// @brief Get the image height
+    kf_nodiscard inline constexpr Pixel height() const { return H; }
+
+    /// @brief Get compressed stream length in buffer elements
+    kf_nodiscard inline constexpr usize size() const { return N; }
+
+    /// @brief Compressed stream
+    const typename Traits::BufferType data[N];
+
+    /// @brief Default constructor is deleted
+    /// @note CompressedImage objects must be initialized with encoded data.
+    CompressedImage() = delete;
+};
+
+}// namespace kf::gfx
@@ -0,0 +1,74 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/algorithm.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/math/units.hpp"
+
+
+namespace kf::gfx {
+
+/// @brief Bounding rectangle of modified pixels
+/// @details Stored in absolute buffer coordinates, bounds are inclusive.
+/// Empty region is represented by left > right.
+struct DirtyRegion final {
+    Pixel left;  ///< Leftmost modified column
+    Pixel top;   ///< Topmost modified row
+    Pixel right; ///< Rightmost modified column
+    Pixel bottom;///< Bottommost modified row
+
+    /// @brief Creates empty region
+    constexpr DirtyRegion() noexcept:
+        left{1}, top{1}, right{0}, bottom{0} {}
+
+    /// @brief Creates region covering [left, right] x [top, bottom]
+    constexpr DirtyRegion(Pixel left, Pixel top, Pixel right, Pixel bottom) noexcept:
+        left{left}, top{top}, right{right}, bottom{bottom} {}
+
+    /// @brief Region covering whole buffer of given size
+    kf_nodiscard static constexpr DirtyRegion full(Pixel width, Pixel height) noexcept {
+        return DirtyRegion{0, 0, static_cast<Pixel>(width - 1), static_cast<Pixel>(height - 1)};
+    }
+
+    /// @brief Checks if nothing was modified
+    kf_nodiscard constexpr bool isEmpty() const noexcept { return left > right or top > bottom; }
+
+    /// @brief Region width in pixels
+    kf_nodiscard constexpr Pixel width() const noexcept { return isEmpty() ? 0 : static_cast<Pixel>(right - left + 1); }
+
+    /// @brief Region height in pixels
+    kf_nodiscard constexpr Pixel height() const noexcept { return isEmpty() ? 0 : static_cast<Pixel>(bottom - top + 1); }
+
+    /// @brief Forget all modifications
+    void clear() noexcept { *this = DirtyRegion{}; }
+
+    /// @brief Extend region by single pixel
+    void add(Pixel x, Pixel y) noexcept { add(x, y, x, y); }
+
+    /// @brief Extend region by rectangle [x0, x1] x [y0, y1]
+    void add(Pixel x0, Pixel y0, Pixel x1, Pixel y1) noexcept {
+        if (x0 > x1 or y0 > y1) { return; }
+
+        if (isEmpty()) {
+            *this = DirtyRegion{x0, y0, x1, y1};
+            return;
+        }
+
+        left = kf::min(left, x0);
+        top = kf::min(top, y0);
+        right = kf::max(right, x1);
+        bottom = kf::max(bottom, y1);
+    }
+
+    /// @brief Restrict region to buffer of given size
+    void clip(Pixel width, Pixel height) noexcept {
+        left = kf::max<Pixel>(left, 0);
+        top = kf::max<Pixel>(top, 0);
+        right = kf::min<Pixel>(right, static_cast<Pixel>(width - 1));
+        bottom = kf::min<Pixel>(bottom, static_cast<Pixel>(height - 1));
+    }
+};
+
+}// namespace kf::gfx
@@ -0,0 +1,485 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstring>
+
+#include "kf/aliases.hpp"
+#include "kf/core/RasterOp.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/core/pixel_traits.hpp"
+#include "kf/math/units.hpp"
+#include "kf/memory/Slice.hpp"
+
+#include "kf/gfx/Canvas.hpp"
+#include "kf/gfx/CompressedImage.hpp"
+#include "kf/gfx/Font.hpp"
+#include "kf/gfx/StaticImage.hpp"
+
+
+namespace kf::gfx {
+
+/// @brief Recorded sequence of Canvas draw calls
+/// @tparam F Pixel format of canvases the list is replayed into
+/// @details Draw calls mirror the Canvas API and are stored as packed byte records
+/// (opcode followed by arguments) in caller-provided storage. Text is copied into the list,
+/// images and fonts are referenced by pointer and must outlive the list (see revision() for lists compared
+/// across in-place changes of their contents).
+/// Replaying the list into a canvas produces the same pixels as direct drawing,
+/// so one list can be rasterized in several passes (e.g. band by band into a small strip buffer).
+template<PixelFormat F> struct DisplayList final {
+
+private:
+    using traits = pixel_traits<F>;
+
+public:
+    using ColorType = typename traits::ColorType;  ///< Pixel color representation
+    using BufferType = typename traits::BufferType;///< Raw buffer element type
+
+private:
+    /// @brief Record kind
+    enum class Opcode : u8 {
+        Foreground,  ///< color
+        Background,  ///< color
+        SetFont,     ///< font pointer
+        AutoNextLine,///< enable flag
+        TextScale,   ///< scale
+        PushClip,    ///< x0, y0, x1, y1
+        PopClip,     ///< -
+        Fill,        ///< -
+        Dot,         ///< x, y
+        Line,        ///< x0, y0, x1, y1
+        Rect,        ///< x0, y0, x1, y1, fill
+        Ellipse,     ///< cx, cy, rx, ry, fill
+        RoundRect,   ///< x0, y0, x1, y1, r, fill
+        Arc,         ///< cx, cy, r, start, end, fill
+        Text,        ///< x, y, length, characters with terminator
+        Image,       ///< x, y, width, height, op, buffer pointer
+        Compressed,  ///< x, y, width, height, stream size, stream pointer
+        Transparent, ///< x, y, width, height, key color, buffer pointer
+        Masked,      ///< x, y, width, height, buffer pointer, mask pointer
+        Bitmap,      ///< x, y, width, height, transparent, bits pointer
+        Revision,    ///< caller-supplied version of referenced data
+    };
+
+    Slice<u8> storage;   ///< Record bytes
+    usize used{0};       ///< Bytes occupied by records
+    bool overflow{false};///< Some record did not fit (it and all later records were dropped)
+
+public:
+    /// @brief Creates empty list over caller-provided storage
+    explicit DisplayList(Slice<u8> storage) noexcept:
+        storage{storage} {}
+
+    /// @brief Drop all records
+    void clear() noexcept {
+        used = 0;
+        overflow = false;
+    }
+
+    /// @brief Bytes occupied by records
+    kf_nodiscard usize size() const noexcept { return used; }
+
+    /// @brief Storage capacity in bytes
+    kf_nodiscard usize capacity() const noexcept { return storage.size(); }
+
+    /// @brief Checks if some draw call was dropped due to lack of storage
+    kf_nodiscard bool overflowed() const noexcept { return overflow; }
+
+    /// @brief Checks if lists record identical draw calls
+    /// @details Records are compared byte-wise. Overflowed lists are incomplete and never equal to anything.
+    /// @warning Images and fonts are compared by pointer identity, not contents: a buffer modified in place
+    /// between two recordings compares equal. Record revision() of such buffers to make the change visible.
+    kf_nodiscard bool operator==(const DisplayList &other) const noexcept {
+        if (overflow or other.overflow or used != other.used) { return false; }
+        return 0 == std::memcmp(storage.data(), other.storage.data(), used);
+    }
+
+    /// @brief Checks if lists differ
+    kf_nodiscard bool operator!=(const DisplayList &other) const noexcept { return not (*this == other); }
+
+    // State
+
+    /// @brief Record Canvas::setForeground
+    void setForeground(ColorType color) noexcept { record(Opcode::Foreground, color); }
+
+    /// @brief Record Canvas::setBackground
+    void setBackground(ColorType color) noexcept { record(Opcode::Background, color); }
+
+    /// @brief Record Canvas::setFont
+    void setFont(const Font &font) noexcept { record(Opcode::SetFont, &font); }
+
+    /// @brief Record Canvas::setAutoNextLine
+    void setAutoNextLine(bool enable) noexcept { record(Opcode::AutoNextLine, static_cast<u8>(enable)); }
+
+    /// @brief Record version of data referenced by later records (no effect on drawing)
+    /// @details Images and fonts are referenced by pointer, so lists compare equal after their contents
+    /// change in place. Recording a version that the caller bumps on every such change makes them differ.
+    void revision(u32 version) noexcept { record(Opcode::Revision, version); }
+
+    /// @brief Record Canvas::setTextScale
+    void setTextScale(u8 scale) noexcept { record(Opcode::TextScale, scale); }
+
+    /// @brief Record Canvas::pushClip
+    void pushClip(Pixel x0, Pixel y0, Pixel x1, Pixel y1) noexcept { record(Opcode::PushClip, x0, y0, x1, y1); }
+
+    /// @brief Record Canvas::popClip
+    void popClip() noexcept { record(Opcode::PopClip); }
+
+    // Drawing
+
+    /// @brief Record Canvas::fill
+    void fill() noexcept { record(Opcode::Fill); }
+
+    /// @brief Record Canvas::dot
+    void dot(Pixel x, Pixel y) noexcept { record(Opcode::Dot, x, y); }
+
+    /// @brief Record Canvas::line
+    void line(Pixel x0, Pixel y0, Pixel x1, Pixel y1) noexcept { record(Opcode::Line, x0, y0, x1, y1); }
+
+    /// @brief Record Canvas::rect
+    void rect(Pixel x0, Pixel y0, Pixel x1, Pixel y1, bool fill) noexcept {
+        record(Opcode::Rect, x0, y0, x1, y1, static_cast<u8>(fill));
+    }
+
+    /// @brief Record Canvas::circle
+    void circle(Pixel cx, Pixel cy, Pixel r, bool fill) noexcept { ellipse(cx, cy, r, r, fill); }
+
+    /// @brief Record Canvas::ellipse
+    void ellipse(Pixel cx, Pixel cy, Pixel rx, Pixel ry, bool fill) noexcept {
+        record(Opcode::Ellipse, cx, cy, rx, ry, static_cast<u8>(fill));
+    }
+
+    /// @brief Record Canvas::roundRect
+    void roundRect(Pixel x0, Pixel y0, Pixel x1, Pixel y1, Pixel r, bool fill) noexcept {
+        record(Opcode::RoundRect, x0, y0, x1, y1, r, static_cast<u8>(fill));
+    }
+
+    /// @brief Record Canvas::arc
+    void arc(Pixel cx, Pixel cy, Pixel r, Degrees start, Degrees end, bool fill = false) noexcept {
+        record(Opcode::Arc, cx, cy, r, start, end, static_cast<u8>(fill));
+    }
+
+    /// @brief Record Canvas::text (text is copied into the list)
+    /// @details Text longer than 65534 bytes does not fit the record and is handled as storage overflow
+    void text(Pixel x, Pixel y, const char *text) noexcept {
+        const auto text_size = std::strlen(text) + 1;
+        if (text_size > 0xFFFF) {
+            overflow = true;
+            return;
+        }
+
+        const auto length = static_cast<u16>(text_size);
+        const auto header = sizeof(Opcode) + sizeof(x) + sizeof(y) + sizeof(length);
+
+        if (not reserve(header + length)) { return; }
+
+        put(Opcode::Text);
+        put(x);
+        put(y);
+        put(length);
+        std::memcpy(storage.data() + used, text, length);
+        used += length;
+    }
+
+    /// @brief Record Canvas::image (image is referenced, not copied)
+    template<Pixel W, Pixel H> void image(
+        Pixel x, Pixel y,
+        const StaticImage<F, W, H> &image,
+        RasterOp op = RasterOp::Copy
+    ) noexcept {
+        this->image(x, y, image.buffer, W, H, op);
+    }
+
+    /// @brief Record Canvas::image for raw buffer (buffer is referenced, not copied)
+    void image(
+        Pixel x, Pixel y,
+        const BufferType *pixels,
+        Pixel image_width, Pixel image_height,
+        RasterOp op = RasterOp::Copy
+    ) noexcept {
+        record(Opcode::Image, x, y, image_width, image_height, op, pixels);
+    }
+
+    /// @brief Record Canvas::transparentImage (image is referenced, not copied)
+    template<Pixel W, Pixel H> void transparentImage(
+        Pixel x, Pixel y,
+        const StaticImage<F, W, H> &image,
+        ColorType key
+    ) noexcept {
+        transparentImage(x, y, image.buffer, W, H, key);
+    }
+
+    /// @brief Record Canvas::transparentImage for raw buffer (buffer is referenced, not copied)
+    void transparentImage(
+        Pixel x, Pixel y,
+        const BufferType *pixels,
+        Pixel image_width, Pixel image_height,
+        ColorType key
+    ) noexcept {
+        record(Opcode::Transparent, x, y, image_width, image_height, key, pixels);
+    }
+
+    /// @brief Record Canvas::maskedImage (image and mask are referenced, not copied)
+    template<Pixel W, Pixel H> void maskedImage(
+        Pixel x, Pixel y,
+        const StaticImage<F, W, H> &image,
+        const StaticImage<PixelFormat::Monochrome, W, H> &mask
+    ) noexcept {
+        maskedImage(x, y, image.buffer, mask.buffer, W, H);
+    }
+
+    /// @brief Record Canvas::maskedImage for raw buffers (buffers are referenced, not copied)
+    void maskedImage(
+        Pixel x, Pixel y,
+        const BufferType *pixels, const u8 *mask,
+        Pixel image_width, Pixel image_height
+    ) noexcept {
+        record(Opcode::Masked, x, y, image_width, image_height, pixels, mask);
+    }
+
+    /// @brief Record Canvas::bitmap (image is referenced, not copied)
+    template<Pixel W, Pixel H> void bitmap(
+        Pixel x, Pixel y,
+        const StaticImage<PixelFormat::Monochrome, W, H> &image,
+        bool transparent = false
+    ) noexcept {
+        bitmap(x, y, image.buffer, W, H, transparent);
+    }
+
+    /// @brief Record Canvas::bitmap for raw bits (bits are referenced, not copied)
+    void bitmap(
+        Pixel x, Pixel y,
+        const u8 *bits,
+        Pixel bitmap_width, Pixel bitmap_height,
+        bool transparent = false
+    ) noexcept {
+        record(Opcode::Bitmap, x, y, bitmap_width, bitmap_height, static_cast<u8>(transparent), bits);
+    }
+
+    /// @brief Record Canvas::image for compressed image (stream is referenced, not copied)
+    template<Pixel W, Pixel H, usize N> void image(
+        Pixel x, Pixel y,
+        const CompressedImage<F, W, H, N> &image
+    ) noexcept {
+        compressedImage(x, y, image.data, N, W, H);
+    }
+
+    /// @brief Record Canvas::compressedImage (stream is referenced, not copied)
+    void compressedImage(
+        Pixel x, Pixel y,
+        const BufferType *data, usize size,
+        Pixel image_width, Pixel image_height
+    ) noexcept {
+        record(Opcode::Compressed, x, y, image_width, image_height, size, data);
+    }
+
+    /// @brief Execute recorded draw calls on canvas
+    /// @details Canvas state (colors, font, clip) is modified as by direct calls,
+    /// clip rectangles pushed by the list are popped at the end
+    template<typename Frame> void replay(Canvas<F, Frame> &canvas) const noexcept {
+        // Bit per pushed clip: set if canvas accepted it
+        u32 clip_pushes{0};
+        u8 clip_depth{0};
+
+        usize position{0};
+        while (position < used) {
+            const auto opcode = get<Opcode>(position);
+
+            switch (opcode) {
+                case Opcode::Foreground: {
+                    canvas.setForeground(get<ColorType>(position));
+                    break;
+                }
+                case Opcode::Background: {
+                    canvas.setBackground(get<ColorType>(position));
+                    break;
+                }
+                case Opcode::SetFont: {
+                    canvas.setFont(*get<const Font *>(position));
+                    break;
+                }
+                case Opcode::AutoNextLine: {
+                    canvas.setAutoNextLine(0 != get<u8>(position));
+                    break;
+                }
+                case Opcode::TextScale: {
+                    canvas.setTextScale(get<u8>(position));
+                    break;
+                }
+                case Opcode::PushClip: {
+                    const auto x0 = get<Pixel>(position);
+                    const auto y0 = get<Pixel>(position);
+                    const auto x1 = get<Pixel>(position);
+                    const auto y1 = get<Pixel>(position);
+
+                    if (canvas.pushClip(x0, y0, x1, y1) and clip_depth < 32) {
+                        clip_pushes |= u32{1} << clip_depth;
+                    }
+                    clip_depth += 1;
+                    break;
+                }
+                case Opcode::PopClip: {
+                    if (clip_depth == 0) { break; }
+
+                    clip_depth -= 1;
+                    if (clip_depth < 32 and (clip_pushes & (u32{1} << clip_depth))) {
+                        clip_pushes &= ~(u32{1} << clip_depth);
+                        canvas.popClip();
+                    }
+                    break;
+                }
+                case Opcode::Fill: {
+                    canvas.fill();
+                    break;
+                }
+                case Opcode::Dot: {
+                    const auto x = get<Pixel>(position);
+                    const auto y = get<Pixel>(position);
+                    canvas.dot(x, y);
+                    break;
+                }
+                case Opcode::Line: {
+                    const auto x0 = get<Pixel>(position);
+                    const auto y0 = get<Pixel>(position);
+                    const auto x1 = get<Pixel>(position);
+                    const auto y1 = get<Pixel>(position);
+                    canvas.line(x0, y0, x1, y1);
+                    break;
+                }
+                case Opcode::Rect: {
+                    const auto x0 = get<Pixel>(position);
+                    const auto y0 = get<Pixel>(position);
+                    const auto x1 = get<Pixel>(position);
+                    const auto y1 = get<Pixel>(position);
+                    canvas.rect(x0, y0, x1, y1, 0 != get<u8>(position));
+                    break;
+                }
+                case Opcode::Ellipse: {
+                    const auto cx = get<Pixel>(position);
+                    const auto cy = get<Pixel>(position);
+                    const auto rx = get<Pixel>(position);
+                    const auto ry = get<Pixel>(position);
+                    canvas.ellipse(cx, cy, rx, ry, 0 != get<u8>(position));
+                    break;
+                }
+                case Opcode::RoundRect: {
+                    const auto x0 = get<Pixel>(position);
+                    const auto y0 = get<Pixel>(position);
+                    const auto x1 = get<Pixel>(position);
+                    const auto y1 = get<Pixel>(position);
+                    const auto r = get<Pixel>(position);
+                    canvas.roundRect(x0, y0, x1, y1, r, 0 != get<u8>(position));
+                    break;
+                }
+                case Opcode::Arc: {
+                    const auto cx = get<Pixel>(position);
+                    const auto cy = get<Pixel>(position);
+                    const auto r = get<Pixel>(position);
+                    const auto start = get<Degrees>(position);
+                    const auto end = get<Degrees>(position);
+                    canvas.arc(cx, cy, r, start, end, 0 != get<u8>(position));
+                    break;
+                }
+                case Opcode::Text: {
+                    const auto x = get<Pixel>(position);
+                    const auto y = get<Pixel>(position);
+                    const auto length = get<u16>(position);
+                    canvas.text(x, y, reinterpret_cast<const char *>(storage.data() + position));
+                    position += length;
+                    break;
+                }
+                case Opcode::Image: {
+                    const auto x = get<Pixel>(position);
+                    const auto y = get<Pixel>(position);
+                    const auto width = get<Pixel>(position);
+                    const auto height = get<Pixel>(position);
+                    const auto op = get<RasterOp>(position);
+                    canvas.image(x, y, get<const BufferType *>(position), width, height, op);
+                    break;
+                }
+                case Opcode::Compressed: {
+                    const auto x = get<Pixel>(position);
+                    const auto y = get<Pixel>(position);
+                    const auto width = get<Pixel>(position);
+                    const auto height = get<Pixel>(position);
+                    const auto size = get<usize>(position);
+                    canvas.compressedImage(x, y, get<const BufferType *>(position), size, width, height);
+                    break;
+                }
+                case Opcode::Transparent: {
+                    const auto x = get<Pixel>(position);
+                    const auto y = get<Pixel>(position);
+                    const auto width = get<Pixel>(position);
+                    const auto height = get<Pixel>(position);
+                    const auto key = get<ColorType>(position);
+                    canvas.transparentImage(x, y, get<const BufferType *>(position), width, height, key);
+                    break;
+                }
+                case Opcode::Masked: {
+                    const auto x = get<Pixel>(position);
+                    const auto y = get<Pixel>(position);
+                    const auto width = get<Pixel>(position);
+                    const auto height = get<Pixel>(position);
+                    const auto pixels = get<const BufferType *>(position);
+                    canvas.maskedImage(x, y, pixels, get<const u8 *>(position), width, height);
+                    break;
+                }
+                case Opcode::Bitmap: {
+                    const auto x = get<Pixel>(position);
+                    const auto y = get<Pixel>(position);
+                    const auto width = get<Pixel>(position);
+                    const auto height = get<Pixel>(position);
+                    const bool transparent = 0 != get<u8>(position);
+                    canvas.bitmap(x, y, get<const u8 *>(position), width, height, transparent);
+                    break;
+                }
+                case Opcode::Revision: {
+                    position += sizeof(u32);
+                    break;
+                }
+            }
+        }
+
+        for (; clip_depth > 0; clip_depth -= 1) {
+            if (clip_depth <= 32 and (clip_pushes & (u32{1} << (clip_depth - 1)))) {
+                canvas.popClip();
+            }
+        }
+    }
+
+private:
+    /// @brief Append record if whole of it fits
+    template<typename... Args> void record(Opcode opcode, Args... args) noexcept {
+        if (not reserve(sizeof(opcode) + (sizeof(args) + ... + 0))) { return; }
+
+        put(opcode);
+        (put(args), ...);
+    }
+
+    /// @brief Check that size bytes fit, mark list overflowed otherwise
+    kf_nodiscard bool reserve(usize size) noexcept {
+        if (overflow or used + size > storage.size()) {
+            overflow = true;
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief Append value bytes (storage must be reserved)
+    template<typename T> void put(T value) noexcept {
+        std::memcpy(storage.data() + used, &value, sizeof(T));
+        used += sizeof(T);
+    }
+
+    /// @brief Read value bytes at position and advance it
+    template<typename T> kf_nodiscard T get(usize &position) const noexcept {
+        T value;
+        std::memcpy(&value, storage.data() + position, sizeof(T));
+        position += sizeof(T);
+        return value;
+    }
+};
+
+}// namespace kf::gfx
@@ -0,0 +1,135 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/aliases.hpp"
+#include "kf/algorithm.hpp"
+#include "kf/core/pixel_traits.hpp"
+#include "kf/math/units.hpp"
+
+#include "kf/gfx/DynamicImage.hpp"
+#include "kf/gfx/StaticImage.hpp"
+
+
+namespace kf::gfx {
+
+/// @brief Ordered dither threshold matrix
+enum class DitherMatrix : u8 {
+    /// @brief 4x4 Bayer matrix: 17 gray levels, coarse pattern
+    Bayer4 = 4,
+
+    /// @brief 8x8 Bayer matrix: 65 gray levels, finer pattern
+    Bayer8 = 8,
+};
+
+/// @brief Convert RGB565 pixels into monochrome frame with ordered dithering
+/// @tparam M Threshold matrix
+/// @details Output is produced page by page: the eight rows of each destination column byte
+/// are thresholded against the matrix and collected in a register, then merged into the frame
+/// with a single store. Matrix is anchored to absolute frame coordinates, so the pattern
+/// stays in place across frames, sub-views and bands.
+/// @param destination Monochrome frame view, receives min(width, height) of both images
+/// @param pixels Source pixels (buffer byte order)
+/// @param pixels_stride Distance between source rows in pixels
+/// @param pixels_width Source width in pixels
+/// @param pixels_height Source height in pixels
+/// @param buffer_rows Rows held by destination buffer from its origin: band strip rows (see DisplayDriver::bandRows)
+/// for band views of full screen height, rows outside the strip are skipped. Default - whole view
+template<DitherMatrix M = DitherMatrix::Bayer4> void ditherOrdered(
+    const DynamicImage<PixelFormat::Monochrome> &destination,
+    const u16 *pixels, Pixel pixels_stride,
+    Pixel pixels_width, Pixel pixels_height,
+    Pixel buffer_rows = 0x7FFF
+) noexcept {
+    using Source = pixel_traits<PixelFormat::RGB565>;
+    using Target = pixel_traits<PixelFormat::Monochrome>;
+
+    // 8x8 Bayer index matrix, its top-left quarter is the 4x4 matrix times 4
+    static constexpr u8 bayer8[8][8]{
+        {0, 32, 8, 40, 2, 34, 10, 42},
+        {48, 16, 56, 24, 50, 18, 58, 26},
+        {12, 44, 4, 36, 14, 46, 6, 38},
+        {60, 28, 52, 20, 62, 30, 54, 22},
+        {3, 35, 11, 43, 1, 33, 9, 41},
+        {51, 19, 59, 27, 49, 17, 57, 25},
+        {15, 47, 7, 39, 13, 45, 5, 37},
+        {63, 31, 55, 23, 61, 29, 53, 21},
+    };
+
+    constexpr auto n = static_cast<u8>(M);
+    constexpr u8 index_shift = (n == 8) ? 0 : 2;
+
+    const auto width = kf::min<i32>(destination.width, pixels_width);
+    const auto height = kf::min<i32>(destination.height, pixels_height);
+    if (width < 1 or height < 1) { return; }
+
+    // Luma above threshold sets pixel: (2i + 1) / 2n^2 of full scale, never 0 or 255
+    u8 thresholds[n][n];
+    for (u8 i = 0; i < n; i += 1) {
+        for (u8 j = 0; j < n; j += 1) {
+            thresholds[i][j] = static_cast<u8>(((2 * (bayer8[i][j] >> index_shift) + 1) * 256) / (2 * n * n));
+        }
+    }
+
+    // Rows and columns outside buffer (band views have negative offsets and full screen height) are skipped
+    const i32 first_col = kf::max<i32>(0, -destination.offset_x);
+    const i32 abs_y0 = kf::max<i32>(0, destination.offset_y);
+    const i32 abs_y1 = kf::min<i32>(destination.offset_y + height, buffer_rows);
+    if (first_col >= width or abs_y0 >= abs_y1) { return; }
+
+    const i32 first_page = abs_y0 / Target::page_height;
+    const i32 last_page = (abs_y1 - 1) / Target::page_height;
+
+    for (i32 page = first_page; page <= last_page; page += 1) {
+        const i32 top = page * Target::page_height;
+        const i32 r0 = kf::max(abs_y0, top);
+        const i32 r1 = kf::min(abs_y1, top + Target::page_height);
+        const auto mask = static_cast<u8>(((1 << (r1 - top)) - 1) & ~((1 << (r0 - top)) - 1));
+
+        const u16 *source_column = pixels + (r0 - destination.offset_y) * pixels_stride;
+        u8 *dest = destination.buffer + page * destination.stride + destination.offset_x;
+
+        for (i32 col = first_col; col < width; col += 1) {
+            const auto threshold_column = static_cast<u8>((destination.offset_x + col) % n);
+            const u16 *source = source_column + col;
+
+            u8 bits = 0;
+            for (i32 row = r0; row < r1; row += 1, source += pixels_stride) {
+                const bool set = Source::luminance(*source) > thresholds[row % n][threshold_column];
+                bits |= static_cast<u8>(set << (row - top));
+            }
+
+            dest[col] = static_cast<u8>((dest[col] & ~mask) | bits);
+        }
+    }
+
+    if (nullptr != destination.dirty) {
+        destination.dirty->add(
+            static_cast<Pixel>(destination.offset_x + first_col), static_cast<Pixel>(abs_y0),
+            static_cast<Pixel>(destination.offset_x + width - 1), static_cast<Pixel>(abs_y1 - 1));
+    }
+}
+
+/// @brief Convert RGB565 frame view (e.g. rendered color canvas) into monochrome frame
+template<DitherMatrix M = DitherMatrix::Bayer4> void ditherOrdered(
+    const DynamicImage<PixelFormat::Monochrome> &destination,
+    const DynamicImage<PixelFormat::RGB565> &source,
+    Pixel buffer_rows = 0x7FFF
+) noexcept {
+    ditherOrdered<M>(
+        destination,
+        source.buffer + source.offset_y * source.stride + source.offset_x, source.stride,
+        source.width, source.height, buffer_rows);
+}
+
+/// @brief Convert RGB565 static image into monochrome frame
+template<DitherMatrix M = DitherMatrix::Bayer4, Pixel W, Pixel H> void ditherOrdered(
+    const DynamicImage<PixelFormat::Monochrome> &destination,
+    const StaticImage<PixelFormat::RGB565, W, H> &image,
+    Pixel buffer_rows = 0x7FFF
+) noexcept {
+    ditherOrdered<M>(destination, image.buffer, W, W, H, buffer_rows);
+}
+
+}// namespace kf::gfx
@@ -4,9 +4,10 @@
 #pragma once
 
 #include "kf/Result.hpp"
-#include "kf/algorithm.hpp"
 #include "kf/core/attributes.hpp"
 #include "kf/core/pixel_traits.hpp"
+#include "kf/gfx/DirtyRegion.hpp"
+#include "kf/gfx/ImageView.hpp"
 #include "kf/math/units.hpp"
 
 
@@ -14,7 +15,8 @@ namespace kf::gfx {
 
 /// @brief Dynamic display region with runtime dimensions
 /// @tparam Format Pixel format for the image data
-template<PixelFormat Format> struct DynamicImage final {
+/// @details Drawing operations are provided by ImageView
+template<PixelFormat Format> struct DynamicImage final : ImageView<DynamicImage<Format>, Format> {
 
 public:
     /// @brief Possible errors when creating FrameView
@@ -33,11 +35,11 @@ public:
     };
 
 private:
-    using Traits = pixel_traits<Format>;
+    using Base = ImageView<DynamicImage, Format>;
 
 public:
-    using BufferType = typename Traits::BufferType;///< Raw buffer element type
-    using ColorType = typename Traits::ColorType;  ///< Pixel color representation
+    using BufferType = typename Base::BufferType;///< Raw buffer element type
+    using ColorType = typename Base::ColorType;  ///< Pixel color representation
 
     /// @brief Pointer to display buffer memory
     BufferType *buffer;
@@ -57,11 +59,15 @@ public:
     /// @brief Region height in pixels
     Pixel height;
 
+    /// @brief Modified area accumulator (optional, absolute coordinates)
+    DirtyRegion *dirty;
+
     /// @brief Creates FrameView with validation
     kf_nodiscard static Result<DynamicImage, Error> create(
         BufferType *buffer, Pixel stride,
         Pixel width, Pixel height,
-        Pixel offset_x, Pixel offset_y
+        Pixel offset_x, Pixel offset_y,
+        DirtyRegion *dirty = nullptr
     ) noexcept {
         if (nullptr == buffer) {
             return Error::BufferNotInit;
@@ -71,26 +77,28 @@ public:
             return Error::SizeTooSmall;
         }
 
-        return DynamicImage(buffer, stride, width, height, offset_x, offset_y);
+        return DynamicImage(buffer, stride, width, height, offset_x, offset_y, dirty);
     }
 
     /// @brief Default constructor - invalid view
     DynamicImage() noexcept:
-        buffer{nullptr}, stride{0}, offset_x{0}, offset_y{0}, width{0}, height{0} {};
+        buffer{nullptr}, stride{0}, offset_x{0}, offset_y{0}, width{0}, height{0}, dirty{nullptr} {};
 
     /// @brief Creates FrameView without validation
     /// @warning Caller must ensure parameters are valid
     explicit DynamicImage(
         BufferType *buffer, Pixel stride,
         Pixel width, Pixel height,
-        Pixel offset_x, Pixel offset_y
+        Pixel offset_x, Pixel offset_y,
+        DirtyRegion *dirty = nullptr
     ) noexcept:
         buffer{buffer},
         stride{stride},
         offset_x{offset_x},
         offset_y{offset_y},
         width{width},
-        height{height} {}
+        height{height},
+        dirty{dirty} {}
 
     /// @brief Creates validated sub-region
     /// @return Sub-view or error if out of bounds
@@ -109,7 +117,7 @@ public:
         const auto new_x = static_cast<Pixel>(offset_x + sub_offset_x);
         const auto new_y = static_cast<Pixel>(offset_y + sub_offset_y);
 
-        return create(buffer, stride, sub_width, sub_height, new_x, new_y);
+        return create(buffer, stride, sub_width, sub_height, new_x, new_y, dirty);
     }
 
     /// @brief Creates sub-region without validation
@@ -121,65 +129,10 @@ public:
         return DynamicImage{
             buffer, stride, sub_width, sub_height,
             static_cast<Pixel>(offset_x + sub_offset_x),
-            static_cast<Pixel>(offset_y + sub_offset_y)
+            static_cast<Pixel>(offset_y + sub_offset_y),
+            dirty
         };
     }
-
-    /// @brief Checks if X coordinate is within view bounds
-    /// @param x Relative X coordinate
-    /// @return True if coordinate is valid
-    kf_nodiscard inline bool isInsideX(Pixel x) const noexcept { return x >= 0 and x < width; }
-
-    /// @brief Checks if Y coordinate is within view bounds
-    /// @param y Relative Y coordinate
-    /// @return True if coordinate is valid
-    kf_nodiscard inline bool isInsideY(Pixel y) const noexcept { return y >= 0 and y < height; }
-
-    /// @brief Checks if view references valid buffer
-    /// @return True if buffer pointer is not null
-    kf_nodiscard bool isValid() const noexcept { return nullptr != buffer; }
-
-    /// @brief Sets single pixel color
-    /// @param x Relative X coordinate
-    /// @param y Relative Y coordinate
-    /// @param color Pixel color value
-    inline void setPixel(Pixel x, Pixel y, ColorType color) const noexcept {
-        Traits::setPixel(buffer, stride, toAbsoluteX(x), toAbsoluteY(y), color);
-    }
-
-    /// @brief Fills entire region with solid color
-    /// @param color Fill color value
-    inline void fill(ColorType color) const noexcept {
-        Traits::fill(buffer, stride, offset_x, offset_y, width, height, color);
-    }
-
-    /// @brief Fills rect region with solid color
-    /// @param color Fill color value
-    void fill(
-        Pixel x0, Pixel y0,
-        Pixel x1, Pixel y1,
-        ColorType color
-    ) const noexcept {
-        Traits::fill(
-            buffer,
-            stride,
-            static_cast<Pixel>(offset_x + x0),
-            static_cast<Pixel>(offset_y + y0),
-            static_cast<Pixel>(x1 - x0 + 1),
-            static_cast<Pixel>(y1 - y0 + 1),
-            color
-        );
-    }
-
-private:
-    /// @brief Converts relative X to absolute buffer coordinate
-    kf_nodiscard inline Pixel toAbsoluteX(Pixel x) const noexcept {
-        return static_cast<Pixel>(offset_x + x);
-    }
-
-    /// @brief Converts relative Y to absolute buffer coordinate
-    kf_nodiscard inline Pixel toAbsoluteY(Pixel y) const noexcept {
-        return static_cast<Pixel>(offset_y + y);
-    }
 };
+
 }// namespace kf::gfx
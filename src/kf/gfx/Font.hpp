@@ -8,11 +8,16 @@
 
 namespace kf::gfx {
 
-/// @brief Monospaced font with glyph height up to 8 pixels
+/// @brief Bitmap font in page layout
 /// @details Represents a bitmap font for monochrome displays.
 /// Each glyph is stored as a horizontal bitmask where each byte represents
-/// a vertical column of pixels. Glyphs are stored consecutively in memory.
+/// a vertical column of 8 pixels. Glyphs taller than 8 pixels take several
+/// pages (rows of column bytes), the same layout as monochrome frames and bitmaps,
+/// so glyphs are drawn by the page blitter. Fonts are monospaced by default;
+/// proportional fonts add per-glyph widths and data offsets. Code points are ASCII 32..126
+/// unless a range table maps sparse code points onto glyphs.
 /// The font data must be stored in program memory (Flash) for embedded systems.
+/// Fonts may be generated with tools/font_compiler.py.
 struct Font final {
     /// @brief First character code in the font (inclusive)
     static constexpr char start_char = 32;///< ASCII space character (0x20)
@@ -20,31 +25,55 @@ struct Font final {
     /// @brief Last character code NOT included in the font (exclusive)
     static constexpr char end_char = 127;///< ASCII DEL character (0x7F), not included
 
+    /// @brief Code points [first, first + count) mapped onto glyphs [glyph, glyph + count)
+    struct Range {
+        u16 first;///< First code point
+        u16 count;///< Number of code points
+        u16 glyph;///< Index of glyph of first code point
+    };
+
+    /// @brief Glyph lookup result
+    struct Glyph {
+        const u8 *bitmap;///< Column bytes in page layout (width bytes per page), nullptr if missing
+        u8 width;        ///< Glyph width in pixels (advance without spacing)
+    };
+
     /// @brief Pointer to font glyph data
     /// @details Array of glyph bitmaps stored consecutively in memory.
-    /// Each glyph consists of `glyph_width` bytes, where each byte represents
-    /// a vertical column of pixels. Within each byte:
-    /// - Bit 0: top pixel (LSB)
-    /// - Bit 1-6: middle pixels (for 7px high fonts)
-    /// - Bit 7: bottom pixel (for 8px high fonts) or unused
-    /// Glyphs are stored in ASCII order starting from `start_char`.
+    /// Each glyph consists of `pages() * width` bytes, page by page, where each byte
+    /// represents a vertical column of 8 pixels. Within each byte:
+    /// - Bit 0: top pixel of the page (LSB)
+    /// - Bit 7: bottom pixel of the page (unused below glyph height)
+    /// Glyphs are stored in ASCII order starting from `start_char` (or in range table order).
     /// Example: For 5×7 font (5 columns, 7 rows):
     ///   Each glyph = 5 bytes, each byte = 1 vertical column (8 bits, but only 7 used)
+    /// Example: For 8×16 font: each glyph = 16 bytes, 8 columns of top page then 8 of bottom page
     /// @warning Must point to valid memory (Flash/PROGMEM for embedded systems)
     const u8 *data;
 
-    /// @brief Width of each glyph in pixels (1-255)
-    /// @details Horizontal size of every character in the font.
-    /// This is a fixed value for monospaced fonts.
+    /// @brief Width of glyph cell in pixels (1-255)
+    /// @details Width of every character for monospaced fonts,
+    /// widest glyph (used for tabs and glyph grid metrics) for proportional fonts.
     /// Example: 5 for 5×7 font means 5 pixels wide, 5 bytes per glyph
     const u8 glyph_width;
 
-    /// @brief Height of each glyph in pixels (1-8)
+    /// @brief Height of each glyph in pixels (1-255)
     /// @details Vertical size of every character in the font.
-    /// Must be between 1 and 8 inclusive for 1-byte per column representation.
     /// Example: 7 for 5×7 font means 7 pixels high, using bits 0-6 of each byte
     const u8 glyph_height;
 
+    /// @brief Per-glyph widths of proportional font (nullptr for monospaced font)
+    const u8 *widths{nullptr};
+
+    /// @brief Per-glyph offsets into data of proportional font (required with widths)
+    const u16 *offsets{nullptr};
+
+    /// @brief Code point ranges sorted by first code point (nullptr for ASCII 32..126)
+    const Range *ranges{nullptr};
+
+    /// @brief Number of entries in range table
+    const u8 range_count{0};
+
     /// @brief Get an instance of empty/blank font
     /// @return Reference to singleton empty font instance
     /// @details Returns a font with null data pointer that can be used as
@@ -72,21 +101,78 @@ struct Font final {
     /// Use this for multi-line text layout calculations.
     kf_nodiscard inline u8 heightTotal() const noexcept { return glyph_height + 1; }
 
+    /// @brief Get number of 8-pixel pages per glyph column
+    kf_nodiscard inline u8 pages() const noexcept { return static_cast<u8>((glyph_height + 7) / 8); }
+
+    /// @brief Checks if glyphs have individual widths
+    kf_nodiscard inline bool isProportional() const noexcept { return nullptr != widths; }
+
+    /// @brief Look up glyph of code point
+    /// @param code Code point
+    /// @return Glyph bitmap and width; missing glyphs have null bitmap and cell width
+    kf_nodiscard Glyph glyph(u16 code) const noexcept { return glyphAt(glyphIndex(code)); }
+
+    /// @brief Get glyph by index (from glyphIndex)
+    /// @param index Glyph index, negative for missing glyph
+    /// @return Glyph bitmap and width; missing glyphs have null bitmap and cell width
+    kf_nodiscard Glyph glyphAt(i32 index) const noexcept {
+        if (nullptr == data or index < 0) {
+            return {nullptr, glyph_width};
+        }
+
+        if (nullptr == widths) {
+            return {data + static_cast<usize>(index) * glyph_width * pages(), glyph_width};
+        }
+
+        return {data + offsets[index], widths[index]};
+    }
+
     /// @brief Get pointer to glyph data for a character
     /// @param c Character code (ASCII)
     /// @return Pointer to glyph bitmap data, or nullptr if:
     ///         - Font data is null
-    ///         - Character is outside font range [start_char, end_char)
+    ///         - Character is not in the font
     /// @details The returned pointer points to the beginning of the glyph's
-    /// bitmap data in the font data array. The glyph data consists of
-    /// `glyph_width` consecutive bytes, each representing a vertical column.
-    /// @note ASCII code 127 (DEL) is excluded from the font
+    /// bitmap data in the font data array (see glyph() for its width).
+    /// @note ASCII code 127 (DEL) is excluded from ASCII fonts
     kf_nodiscard const u8 *getGlyph(char c) const noexcept {
-        if (nullptr == data or c < start_char or c >= end_char) {
-            return nullptr;
+        return glyph(static_cast<u8>(c)).bitmap;
+    }
+
+    /// @brief Index of glyph of code point
+    /// @return Glyph index or -1 if code point is not in the font
+    /// @details ASCII fonts and the first range (dense ASCII block) resolve directly,
+    /// other code points by binary search of the range table.
+    kf_nodiscard i32 glyphIndex(u16 code) const noexcept {
+        if (nullptr == ranges) {
+            const bool inside = code >= static_cast<u16>(start_char) and code < static_cast<u16>(end_char);
+            return inside ? code - start_char : -1;
         }
 
-        return data + (static_cast<usize>(c - start_char) * glyph_width);
+        if (range_count == 0) { return -1; }
+
+        const auto first_offset = static_cast<u16>(code - ranges[0].first);
+        if (first_offset < ranges[0].count) {
+            return ranges[0].glyph + first_offset;
+        }
+
+        // Binary search of last range starting at or before code
+        u8 low = 0;
+        u8 high = range_count;
+        while (low < high) {
+            const auto middle = static_cast<u8>((low + high) / 2);
+            if (ranges[middle].first <= code) {
+                low = static_cast<u8>(middle + 1);
+            } else {
+                high = middle;
+            }
+        }
+
+        if (low == 0) { return -1; }
+
+        const Range &range = ranges[low - 1];
+        const auto offset = static_cast<u16>(code - range.first);
+        return (offset < range.count) ? range.glyph + offset : -1;
     }
 };
 
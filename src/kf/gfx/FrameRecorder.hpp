@@ -0,0 +1,65 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/core/pixel_traits.hpp"
+#include "kf/memory/Slice.hpp"
+
+#include "kf/gfx/DisplayList.hpp"
+
+
+namespace kf::gfx {
+
+/// @brief Records frames as display lists and detects frames equal to the previous one
+/// @tparam F Pixel format of recorded canvases
+/// @details Storage is split between current and previous frame lists, which swap on begin().
+/// When changed() reports an identical frame, rasterization and transfer can be skipped:
+/// @code
+/// auto &list = recorder.begin();
+/// list.fill();
+/// list.text(0, 0, label);
+/// if (recorder.changed()) { display.render(recorder.current()); }
+/// @endcode
+template<PixelFormat F> struct FrameRecorder final {
+
+private:
+    DisplayList<F> lists[2]; ///< Frame lists, roles swap every frame
+    u8 current_index{0};     ///< Index of list being recorded
+    bool force_next{true};   ///< Next frame counts as changed regardless of contents
+    bool force_current{true};///< Current frame counts as changed regardless of contents
+
+public:
+    /// @brief Creates recorder over caller-provided storage (halved between two frames)
+    explicit FrameRecorder(Slice<u8> storage) noexcept:
+        lists{
+            DisplayList<F>{Slice<u8>{storage.data(), storage.size() / 2}},
+            DisplayList<F>{Slice<u8>{storage.data() + storage.size() / 2, storage.size() / 2}},
+        } {}
+
+    /// @brief Start recording new frame
+    /// @return Empty list to record frame into (previous frame is kept for comparison)
+    DisplayList<F> &begin() noexcept {
+        current_index ^= 1;
+        lists[current_index].clear();
+        force_current = force_next;
+        force_next = false;
+        return lists[current_index];
+    }
+
+    /// @brief Checks if recorded frame differs from previous one
+    /// @details Also true for the first frame, after invalidate() and when any list overflowed
+    kf_nodiscard bool changed() const noexcept {
+        return force_current or lists[current_index] != lists[current_index ^ 1];
+    }
+
+    /// @brief Force next frame to count as changed (e.g. after display reinit or external drawing)
+    void invalidate() noexcept { force_next = true; }
+
+    /// @brief List of the frame being recorded (or last recorded)
+    kf_nodiscard const DisplayList<F> &current() const noexcept { return lists[current_index]; }
+};
+
+}// namespace kf::gfx
@@ -0,0 +1,124 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/aliases.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/core/pixel_traits.hpp"
+#include "kf/gfx/Font.hpp"
+#include "kf/memory/Slice.hpp"
+
+
+namespace kf::gfx {
+
+/// @brief Fixed-size LRU cache of glyphs pre-expanded into frame pixels
+/// @tparam F Pixel format of expanded glyphs
+/// @details Each entry holds one glyph rendered with a (foreground, background) color pair,
+/// so drawing a cached glyph is a row copy into the frame instead of per-bit expansion.
+/// Intended for RGB565 canvases, where text uses a few dozen color pairs at most.
+/// Entry storage is provided by the caller, memory use is bounded by its size.
+template<PixelFormat F> struct GlyphCache final {
+
+private:
+    using traits = pixel_traits<F>;
+
+public:
+    using BufferType = typename traits::BufferType;///< Raw buffer element type
+    using ColorType = typename traits::ColorType;  ///< Pixel color representation
+
+    /// @brief Largest cacheable glyph width (larger glyphs bypass the cache)
+    static constexpr u8 max_glyph_width = 8;
+
+    /// @brief Largest cacheable glyph height (larger glyphs bypass the cache)
+    static constexpr u8 max_glyph_height = 8;
+
+    /// @brief Cached glyph slot
+    struct Entry {
+        const Font *font{nullptr}; ///< Owner font (nullptr - slot unused)
+        const u8 *glyph{nullptr};  ///< Glyph bitmap data in font
+        ColorType foreground{};    ///< Color of set glyph bits
+        ColorType background{};    ///< Color of clear glyph bits
+        u32 last_use{0};           ///< Use stamp for LRU eviction
+
+        /// @brief Expanded pixels, glyph width pixels per row
+        BufferType pixels[traits::template buffer_size<max_glyph_width, max_glyph_height>]{};
+    };
+
+private:
+    Slice<Entry> entries;///< Cache slots
+    u32 clock{0};        ///< Use stamp counter
+    u32 hit_count{0};    ///< Lookups served from cache
+    u32 miss_count{0};   ///< Lookups that required expansion
+
+public:
+    /// @brief Creates cache over caller-provided slots
+    explicit GlyphCache(Slice<Entry> storage) noexcept:
+        entries{storage} {}
+
+    /// @brief Get glyph expanded with color pair, expanding it on miss
+    /// @param font Font owning glyph
+    /// @param glyph Glyph of font (from Font::glyph)
+    /// @param foreground Color of set glyph bits
+    /// @param background Color of clear glyph bits
+    /// @return Expanded pixels (glyph.width per row, font.glyph_height rows)
+    /// or nullptr if glyph does not fit entry or cache has no slots
+    kf_nodiscard const BufferType *get(
+        const Font &font,
+        const Font::Glyph &glyph,
+        ColorType foreground,
+        ColorType background
+    ) noexcept {
+        if (entries.size() == 0 or glyph.width > max_glyph_width or font.glyph_height > max_glyph_height) {
+            return nullptr;
+        }
+
+        clock += 1;
+
+        Entry *victim = entries.begin();
+        for (auto &entry: entries) {
+            if (entry.glyph == glyph.bitmap and entry.font == &font and entry.foreground == foreground and entry.background == background) {
+                entry.last_use = clock;
+                hit_count += 1;
+                return entry.pixels;
+            }
+
+            if (entry.last_use < victim->last_use) {
+                victim = &entry;
+            }
+        }
+
+        miss_count += 1;
+
+        victim->font = &font;
+        victim->glyph = glyph.bitmap;
+        victim->foreground = foreground;
+        victim->background = background;
+        victim->last_use = clock;
+
+        traits::bitmap(
+            victim->pixels, glyph.width,
+            0, 0, glyph.width, font.glyph_height,
+            0, 0,
+            glyph.bitmap, glyph.width, font.glyph_height,
+            foreground, background);
+
+        return victim->pixels;
+    }
+
+    /// @brief Drop all cached glyphs (e.g. after font data change)
+    void clear() noexcept {
+        for (auto &entry: entries) {
+            entry = Entry{};
+        }
+        clock = 0;
+    }
+
+    /// @brief Number of lookups served from cache
+    kf_nodiscard u32 hits() const noexcept { return hit_count; }
+
+    /// @brief Number of lookups that required expansion
+    kf_nodiscard u32 misses() const noexcept { return miss_count; }
+};
+
+}// namespace kf::gfx
@@ -0,0 +1,263 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/algorithm.hpp"
+#include "kf/core/RasterOp.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/core/pixel_traits.hpp"
+#include "kf/gfx/DirtyRegion.hpp"
+#include "kf/math/units.hpp"
+
+
+namespace kf::gfx {
+
+/// @brief CRTP base with drawing operations of image views
+/// @tparam Impl View type with buffer, stride, offset_x, offset_y, width, height and dirty members
+/// @tparam Format Pixel format for the image data
+/// @details Geometry is read through Impl: runtime members of DynamicImage or static constants of
+/// StaticFrame, where inlined address math and clamps fold into constants.
+template<typename Impl, PixelFormat Format> struct ImageView {
+
+protected:
+    using Traits = pixel_traits<Format>;
+
+public:
+    using BufferType = typename Traits::BufferType;///< Raw buffer element type
+    using ColorType = typename Traits::ColorType;  ///< Pixel color representation
+
+    /// @brief Checks if X coordinate is within view bounds
+    /// @param x Relative X coordinate
+    /// @return True if coordinate is valid
+    kf_nodiscard inline bool isInsideX(Pixel x) const noexcept { return x >= 0 and x < impl().width; }
+
+    /// @brief Checks if Y coordinate is within view bounds
+    /// @param y Relative Y coordinate
+    /// @return True if coordinate is valid
+    kf_nodiscard inline bool isInsideY(Pixel y) const noexcept { return y >= 0 and y < impl().height; }
+
+    /// @brief Checks if view references valid buffer
+    /// @return True if buffer pointer is not null
+    kf_nodiscard bool isValid() const noexcept { return nullptr != impl().buffer; }
+
+    /// @brief Sets single pixel color
+    /// @param x Relative X coordinate
+    /// @param y Relative Y coordinate
+    /// @param color Pixel color value
+    inline void setPixel(Pixel x, Pixel y, ColorType color) const noexcept {
+        const auto abs_x = toAbsoluteX(x);
+        const auto abs_y = toAbsoluteY(y);
+        Traits::setPixel(impl().buffer, impl().stride, abs_x, abs_y, color);
+
+        if (nullptr != impl().dirty) {
+            impl().dirty->add(abs_x, abs_y);
+        }
+    }
+
+    /// @brief Fills entire region with solid color
+    /// @param color Fill color value
+    inline void fill(ColorType color) const noexcept {
+        Traits::fill(impl().buffer, impl().stride, impl().offset_x, impl().offset_y, impl().width, impl().height, color);
+        markDirty(0, 0, static_cast<Pixel>(impl().width - 1), static_cast<Pixel>(impl().height - 1));
+    }
+
+    /// @brief Fills rect region with solid color
+    /// @param color Fill color value
+    void fill(
+        Pixel x0, Pixel y0,
+        Pixel x1, Pixel y1,
+        ColorType color
+    ) const noexcept {
+        Traits::fill(
+            impl().buffer,
+            impl().stride,
+            static_cast<Pixel>(impl().offset_x + x0),
+            static_cast<Pixel>(impl().offset_y + y0),
+            static_cast<Pixel>(x1 - x0 + 1),
+            static_cast<Pixel>(y1 - y0 + 1),
+            color
+        );
+        markDirty(x0, y0, x1, y1);
+    }
+
+    /// @brief Copies rect [x0, x1] x [y0, y1] from buffer of the same geometry (stride and layout)
+    /// @param source Buffer as large as this view's buffer, e.g. cached background layer
+    /// @details Same absolute pixels are copied (row or page copies), rect is clipped to region bounds.
+    void restore(
+        const BufferType *source,
+        Pixel x0, Pixel y0,
+        Pixel x1, Pixel y1
+    ) const noexcept {
+        x0 = kf::max<Pixel>(x0, 0);
+        y0 = kf::max<Pixel>(y0, 0);
+        x1 = kf::min<Pixel>(x1, static_cast<Pixel>(impl().width - 1));
+        y1 = kf::min<Pixel>(y1, static_cast<Pixel>(impl().height - 1));
+
+        if (x0 > x1 or y0 > y1) { return; }
+
+        Traits::copyRect(
+            impl().buffer, source, impl().stride,
+            toAbsoluteX(x0), toAbsoluteY(y0),
+            static_cast<Pixel>(x1 - x0 + 1),
+            static_cast<Pixel>(y1 - y0 + 1)
+        );
+        markDirty(x0, y0, x1, y1);
+    }
+
+    /// @brief Moves region contents by (dx, dy) in place
+    /// @details Pixels moved past region edges are dropped, uncovered strip keeps previous contents.
+    void scroll(Pixel dx, Pixel dy) const noexcept {
+        if (dx == 0 and dy == 0) { return; }
+
+        Traits::scroll(impl().buffer, impl().stride, impl().offset_x, impl().offset_y, impl().width, impl().height, dx, dy);
+        markDirty(0, 0, static_cast<Pixel>(impl().width - 1), static_cast<Pixel>(impl().height - 1));
+    }
+
+    /// @brief Copies source image into region
+    /// @param x Relative left position
+    /// @param y Relative top position
+    /// @param source Source buffer in the same pixel format
+    /// @param source_width Source width in pixels
+    /// @param source_height Source height in pixels
+    /// @param op Raster operation to combine source with region pixels
+    void copy(
+        Pixel x, Pixel y,
+        const BufferType *source,
+        Pixel source_width, Pixel source_height,
+        RasterOp op = RasterOp::Copy
+    ) const noexcept {
+        Traits::copy(
+            impl().buffer, impl().stride,
+            impl().offset_x, impl().offset_y,
+            impl().width, impl().height,
+            x, y,
+            source, source_width, source_height,
+            op
+        );
+        markDirty(x, y, static_cast<Pixel>(x + source_width - 1), static_cast<Pixel>(y + source_height - 1));
+    }
+
+    /// @brief Copies source image into region skipping pixels of key color
+    /// @param x Relative left position
+    /// @param y Relative top position
+    /// @param source Source buffer in the same pixel format
+    /// @param source_width Source width in pixels
+    /// @param source_height Source height in pixels
+    /// @param key Transparent color
+    void copyKeyed(
+        Pixel x, Pixel y,
+        const BufferType *source,
+        Pixel source_width, Pixel source_height,
+        ColorType key
+    ) const noexcept {
+        Traits::copyKeyed(
+            impl().buffer, impl().stride,
+            impl().offset_x, impl().offset_y,
+            impl().width, impl().height,
+            x, y,
+            source, source_width, source_height,
+            key
+        );
+        markDirty(x, y, static_cast<Pixel>(x + source_width - 1), static_cast<Pixel>(y + source_height - 1));
+    }
+
+    /// @brief Copies source image into region through 1-bit alpha mask
+    /// @param x Relative left position
+    /// @param y Relative top position
+    /// @param source Source buffer in the same pixel format
+    /// @param source_width Source width in pixels
+    /// @param source_height Source height in pixels
+    /// @param mask Mask column bytes (monochrome page layout), set bits mark opaque pixels
+    void copyMasked(
+        Pixel x, Pixel y,
+        const BufferType *source,
+        Pixel source_width, Pixel source_height,
+        const u8 *mask
+    ) const noexcept {
+        Traits::copyMasked(
+            impl().buffer, impl().stride,
+            impl().offset_x, impl().offset_y,
+            impl().width, impl().height,
+            x, y,
+            source, source_width, source_height,
+            mask
+        );
+        markDirty(x, y, static_cast<Pixel>(x + source_width - 1), static_cast<Pixel>(y + source_height - 1));
+    }
+
+    /// @brief Draws 1-bit bitmap (monochrome page layout) with color pair
+    /// @param x Relative left position
+    /// @param y Relative top position
+    /// @param bits Bitmap column bytes, bitmap_width bytes per 8-pixel page
+    /// @param bitmap_width Bitmap width in pixels
+    /// @param bitmap_height Bitmap height in pixels
+    /// @param on Color of set bits
+    /// @param off Color of clear bits
+    void bitmap(
+        Pixel x, Pixel y,
+        const u8 *bits,
+        Pixel bitmap_width, Pixel bitmap_height,
+        ColorType on, ColorType off
+    ) const noexcept {
+        Traits::bitmap(
+            impl().buffer, impl().stride,
+            impl().offset_x, impl().offset_y,
+            impl().width, impl().height,
+            x, y,
+            bits, bitmap_width, bitmap_height,
+            on, off
+        );
+        markDirty(x, y, static_cast<Pixel>(x + bitmap_width - 1), static_cast<Pixel>(y + bitmap_height - 1));
+    }
+
+    /// @brief Draws set bits of 1-bit bitmap (monochrome page layout), clear bits are transparent
+    /// @param x Relative left position
+    /// @param y Relative top position
+    /// @param bits Bitmap column bytes, bitmap_width bytes per 8-pixel page
+    /// @param bitmap_width Bitmap width in pixels
+    /// @param bitmap_height Bitmap height in pixels
+    /// @param on Color of set bits
+    void bitmapTransparent(
+        Pixel x, Pixel y,
+        const u8 *bits,
+        Pixel bitmap_width, Pixel bitmap_height,
+        ColorType on
+    ) const noexcept {
+        Traits::bitmapTransparent(
+            impl().buffer, impl().stride,
+            impl().offset_x, impl().offset_y,
+            impl().width, impl().height,
+            x, y,
+            bits, bitmap_width, bitmap_height,
+            on
+        );
+        markDirty(x, y, static_cast<Pixel>(x + bitmap_width - 1), static_cast<Pixel>(y + bitmap_height - 1));
+    }
+
+private:
+    inline const Impl &impl() const noexcept { return *static_cast<const Impl *>(this); }
+
+    /// @brief Adds relative rect [x0, x1] x [y0, y1] clipped to region bounds into dirty area
+    inline void markDirty(Pixel x0, Pixel y0, Pixel x1, Pixel y1) const noexcept {
+        if (nullptr == impl().dirty) { return; }
+
+        impl().dirty->add(
+            toAbsoluteX(kf::max<Pixel>(x0, 0)),
+            toAbsoluteY(kf::max<Pixel>(y0, 0)),
+            toAbsoluteX(kf::min<Pixel>(x1, static_cast<Pixel>(impl().width - 1))),
+            toAbsoluteY(kf::min<Pixel>(y1, static_cast<Pixel>(impl().height - 1))));
+    }
+
+    /// @brief Converts relative X to absolute buffer coordinate
+    kf_nodiscard inline Pixel toAbsoluteX(Pixel x) const noexcept {
+        return static_cast<Pixel>(impl().offset_x + x);
+    }
+
+    /// @brief Converts relative Y to absolute buffer coordinate
+    kf_nodiscard inline Pixel toAbsoluteY(Pixel y) const noexcept {
+        return static_cast<Pixel>(impl().offset_y + y);
+    }
+};
+
+}// namespace kf::gfx
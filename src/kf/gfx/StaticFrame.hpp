@@ -0,0 +1,81 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/Result.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/core/pixel_traits.hpp"
+#include "kf/gfx/DirtyRegion.hpp"
+#include "kf/gfx/DynamicImage.hpp"
+#include "kf/gfx/ImageView.hpp"
+#include "kf/math/units.hpp"
+
+
+namespace kf::gfx {
+
+/// @brief Whole frame buffer view with compile-time dimensions
+/// @tparam Format Pixel format for the image data
+/// @tparam W Frame width in pixels (row stride)
+/// @tparam H Frame height in pixels
+/// @details Same drawing operations as DynamicImage (see ImageView), but stride, offsets and size
+/// are constants: address math of inlined pixel writes and clamps to view bounds fold at compile time.
+/// Sub-regions are runtime DynamicImage views.
+template<PixelFormat Format, Pixel W, Pixel H> struct StaticFrame final : ImageView<StaticFrame<Format, W, H>, Format> {
+    static_assert(W > 0 and H > 0, "Frame must be at least 1x1");
+
+private:
+    using Base = ImageView<StaticFrame, Format>;
+
+public:
+    using BufferType = typename Base::BufferType;///< Raw buffer element type
+    using ColorType = typename Base::ColorType;  ///< Pixel color representation
+    using Error = typename DynamicImage<Format>::Error;///< Sub-region errors
+
+    static constexpr Pixel stride{W};  ///< Row stride (frame width)
+    static constexpr Pixel offset_x{0};///< Frame starts at buffer origin
+    static constexpr Pixel offset_y{0};///< Frame starts at buffer origin
+    static constexpr Pixel width{W};   ///< Frame width in pixels
+    static constexpr Pixel height{H};  ///< Frame height in pixels
+
+    /// @brief Required buffer size in elements
+    static constexpr usize buffer_items{pixel_traits<Format>::template buffer_size<W, H>};
+
+    /// @brief Pointer to frame buffer memory (buffer_items elements)
+    BufferType *buffer;
+
+    /// @brief Modified area accumulator (optional)
+    DirtyRegion *dirty;
+
+    /// @brief Default constructor - invalid view
+    StaticFrame() noexcept:
+        buffer{nullptr}, dirty{nullptr} {}
+
+    /// @brief Creates view of whole frame buffer
+    explicit StaticFrame(BufferType *buffer, DirtyRegion *dirty = nullptr) noexcept:
+        buffer{buffer}, dirty{dirty} {}
+
+    /// @brief Runtime view of the same frame
+    kf_nodiscard operator DynamicImage<Format>() const noexcept {
+        return DynamicImage<Format>{buffer, W, W, H, 0, 0, dirty};
+    }
+
+    /// @brief Creates validated sub-region (see DynamicImage::sub)
+    kf_nodiscard Result<DynamicImage<Format>, Error> sub(
+        Pixel sub_width, Pixel sub_height,
+        Pixel sub_offset_x, Pixel sub_offset_y
+    ) const noexcept {
+        return DynamicImage<Format>{*this}.sub(sub_width, sub_height, sub_offset_x, sub_offset_y);
+    }
+
+    /// @brief Creates sub-region without validation
+    /// @warning No bounds checking - caller must ensure parameters are valid
+    kf_nodiscard DynamicImage<Format> subUnchecked(
+        Pixel sub_width, Pixel sub_height,
+        Pixel sub_offset_x, Pixel sub_offset_y
+    ) const noexcept {
+        return DynamicImage<Format>{buffer, W, sub_width, sub_height, sub_offset_x, sub_offset_y, dirty};
+    }
+};
+
+}// namespace kf::gfx
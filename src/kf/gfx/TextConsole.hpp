@@ -0,0 +1,87 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/Function.hpp"
+#include "kf/aliases.hpp"
+#include "kf/core/PixelFormat.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/gfx/Canvas.hpp"
+#include "kf/math/units.hpp"
+
+
+namespace kf::gfx {
+
+/// @brief Scrolling text log drawn into a canvas
+/// @details Appended text goes below previous lines. When it does not fit, older lines are moved up
+/// with Canvas::scroll and only the appended lines are drawn, so each print touches
+/// the uncovered strip instead of redrawing the whole log.
+/// Font, colors, text scale and wrapping are taken from the console canvas.
+/// @code
+/// TextConsole<PixelFormat::Monochrome> console{canvas};
+/// console.clear();
+/// console.print("\033F2ok\033N boot");
+///
+/// // Full-screen console on SSD1306: move display RAM instead of resending the frame
+/// console.setScroller([&display](Pixel dy) { display.scroll(dy); });
+/// @endcode
+template<PixelFormat F> struct TextConsole final {
+
+    /// @brief Replacement of canvas scroll: moves contents vertically by dy, fills uncovered rows
+    using Scroller = Function<void(Pixel)>;
+
+private:
+    Canvas<F> area;            ///< Console canvas
+    Pixel line_top{0};         ///< Top of next line
+    Scroller scroller{nullptr};///< Custom scroll (canvas scroll if empty)
+
+public:
+    /// @brief Create console over canvas, next line starts at the top
+    /// @note Canvas contents are kept, call clear() to start from an empty console
+    explicit TextConsole(const Canvas<F> &canvas) noexcept:
+        area{canvas} {}
+
+    /// @brief Console canvas (font, colors, text scale, wrapping)
+    kf_nodiscard Canvas<F> &canvas() noexcept { return area; }
+
+    /// @brief Set custom scroll (e.g. display hardware scroll), nullptr restores canvas scroll
+    /// @details Used instead of Canvas::scroll, so it must cover the same area as the console canvas
+    void setScroller(Scroller custom_scroller) noexcept { scroller = std::move(custom_scroller); }
+
+    /// @brief Erase console and move to the top
+    void clear() noexcept {
+        area.fill();
+        line_top = 0;
+    }
+
+    /// @brief Append text as new line(s)
+    /// @param text UTF-8 text with control sequences, new lines and (with auto next line) wrapping
+    /// @details Log is scrolled up by the height of lines that do not fit, text taller than
+    /// the console keeps its last lines.
+    void print(const char *text) noexcept {
+        const auto lines = kf::max<u16>(area.measure(text).lines, 1);
+        const auto text_height = static_cast<Pixel>(lines * area.glyphHeight());
+        const auto overflow = static_cast<Pixel>(line_top + text_height - area.height());
+
+        if (overflow > 0) {
+            scroll(static_cast<Pixel>(-overflow));
+            line_top = static_cast<Pixel>(line_top - overflow);
+        }
+
+        area.text(0, line_top, text);
+        line_top = static_cast<Pixel>(line_top + text_height);
+    }
+
+private:
+    /// @brief Move lines up by -dy rows
+    void scroll(Pixel dy) noexcept {
+        if (scroller) {
+            scroller(dy);
+        } else {
+            area.scroll(0, dy);
+        }
+    }
+};
+
+}// namespace kf::gfx
@@ -0,0 +1,259 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "kf/aliases.hpp"
+#include "kf/core/PixelFormat.hpp"
+#include "kf/core/attributes.hpp"
+#include "kf/gfx/Font.hpp"
+#include "kf/math/units.hpp"
+#include "kf/memory/Slice.hpp"
+
+
+namespace kf::gfx {
+
+template<PixelFormat F, typename Frame> struct Canvas;
+
+/// @brief Control sequences of UTF-8 text drawn by Canvas
+/// @details Sequences start with ESC (0x1B), which never occurs inside UTF-8 encoded characters:
+///   ESC N - Normal color mode (text - fg, bg)
+///   ESC I - Invert color mode (bg, text - fg)
+///   ESC S - Swap current colors
+///   ESC F h - Set foreground color to ANSI color (h - hex digit 0-9, A-F)
+///   ESC B h - Set background color to ANSI color (h - hex digit 0-9, A-F)
+/// Write ESC as octal "\033" in literals: hex escapes would swallow following hex digits
+/// (e.g. "\033F2" "ok" "\033N").
+struct TextControl final {
+    static constexpr char escape = '\x1B';    ///< Control sequence introducer
+    static constexpr char normal = 'N';       ///< Normal colors
+    static constexpr char invert = 'I';       ///< Inverted colors
+    static constexpr char swap = 'S';         ///< Swap current colors
+    static constexpr char foreground = 'F';   ///< Foreground ANSI color, hex digit follows
+    static constexpr char background = 'B';   ///< Background ANSI color, hex digit follows
+};
+
+/// @brief Text decoded into glyph indices of a font
+/// @details UTF-8 decoding, control sequence parsing and glyph lookup are done once
+/// when text is assigned; drawing a run with Canvas::text only indexes glyphs.
+/// Items are glyph indices below token_base or tokens (control codes, missing glyphs).
+/// Token storage is provided by the caller.
+struct TextRun final {
+
+    /// @brief Smallest token value, fonts must have fewer glyphs
+    static constexpr u16 token_base = 0xFF00;
+
+    /// @brief Tokens of decoded text
+    enum Token : u16 {
+        End = token_base,        ///< End of text (not stored in runs)
+        NewLine,                 ///< Line feed
+        Tab,                     ///< Horizontal tab
+        Normal,                  ///< Normal colors
+        Invert,                  ///< Inverted colors
+        Swap,                    ///< Swap current colors
+        Missing,                 ///< Character without glyph (drawn as box)
+        Foreground = 0xFF10,     ///< Foreground ANSI color in low nibble
+        Background = 0xFF20,     ///< Background ANSI color in low nibble
+    };
+
+    /// @brief Replacement code point of malformed or non-BMP sequences
+    static constexpr u16 replacement_char = 0xFFFD;
+
+private:
+    const Font *run_font;///< Font of glyph indices
+    Slice<u16> items;    ///< Token storage
+    usize length{0};     ///< Used tokens
+
+public:
+    /// @brief Create empty run over caller-provided storage
+    /// @param font Font used for glyph lookup (must outlive run)
+    /// @param storage Token storage (one token per character or control sequence)
+    TextRun(const Font &font, Slice<u16> storage) noexcept:
+        run_font{&font}, items{storage} {}
+
+    /// @brief Decode text into run
+    /// @param text Null-terminated UTF-8 text with control sequences
+    /// @return false if storage is too small (run holds the text prefix that fits)
+    kf_nodiscard bool assign(const char *text) noexcept {
+        length = 0;
+
+        while (true) {
+            const auto token = next(*run_font, text);
+            if (token == End) { return true; }
+            if (length == items.size()) { return false; }
+
+            items[length] = token;
+            length += 1;
+        }
+    }
+
+    /// @brief Font of glyph indices
+    kf_nodiscard const Font &font() const noexcept { return *run_font; }
+
+    /// @brief Number of tokens
+    kf_nodiscard usize size() const noexcept { return length; }
+
+    kf_nodiscard const u16 *begin() const noexcept { return items.data(); }
+
+    kf_nodiscard const u16 *end() const noexcept { return items.data() + length; }
+
+    /// @brief Decode next token of text
+    /// @param font Font used for glyph lookup
+    /// @param text Cursor into null-terminated text, advanced past decoded sequence
+    /// @return Glyph index or token, End at terminator
+    kf_nodiscard static u16 next(const Font &font, const char *&text) noexcept {
+        while (true) {
+            const auto byte = static_cast<u8>(*text);
+
+            switch (byte) {
+                case '\0': return End;
+
+                case '\n': {
+                    text += 1;
+                    return NewLine;
+                }
+
+                case '\t': {
+                    text += 1;
+                    return Tab;
+                }
+
+                case TextControl::escape: {
+                    const auto token = control(text);
+                    if (token != Missing) { return token; }
+                    continue;// Unknown sequence skipped
+                }
+
+                default: {
+                    const auto index = font.glyphIndex(decodeUtf8(text));
+                    return (index < 0 or index >= token_base) ? u16{Missing} : static_cast<u16>(index);
+                }
+            }
+        }
+    }
+
+    /// @brief Decode one UTF-8 encoded code point
+    /// @param text Cursor into null-terminated text (not at terminator), advanced past sequence
+    /// @return Code point, replacement_char for malformed sequences and code points above U+FFFF
+    kf_nodiscard static u16 decodeUtf8(const char *&text) noexcept {
+        const auto lead = static_cast<u8>(*text);
+        text += 1;
+
+        u8 continuation;
+        u32 code;
+
+        if (lead < 0x80) {
+            return lead;
+        } else if (lead >= 0xC2 and lead <= 0xDF) {
+            continuation = 1;
+            code = lead & 0x1F;
+        } else if (lead >= 0xE0 and lead <= 0xEF) {
+            continuation = 2;
+            code = lead & 0x0F;
+        } else if (lead >= 0xF0 and lead <= 0xF4) {
+            continuation = 3;
+            code = lead & 0x07;
+        } else {
+            return replacement_char;
+        }
+
+        for (; continuation > 0; continuation -= 1) {
+            // Terminator is not a continuation byte, so decoding stops before it
+            const auto byte = static_cast<u8>(*text);
+            if ((byte & 0xC0) != 0x80) { return replacement_char; }
+
+            code = (code << 6) | (byte & 0x3F);
+            text += 1;
+        }
+
+        return (code > 0xFFFF) ? replacement_char : static_cast<u16>(code);
+    }
+
+private:
+    /// @brief Parse control sequence at ESC, Missing for unknown or truncated sequence
+    kf_nodiscard static u16 control(const char *&text) noexcept {
+        text += 1;
+        const char command = *text;
+        if (command == '\0') { return Missing; }
+        text += 1;
+
+        switch (command) {
+            case TextControl::normal: return Normal;
+            case TextControl::invert: return Invert;
+            case TextControl::swap: return Swap;
+
+            case TextControl::foreground:
+            case TextControl::background: {
+                const auto digit = hexDigit(*text);
+                if (digit < 0) { return Missing; }
+                text += 1;
+                return static_cast<u16>((command == TextControl::foreground ? Foreground : Background) | digit);
+            }
+
+            default: return Missing;
+        }
+    }
+
+    /// @brief Value of hex digit character, -1 if not a hex digit
+    kf_nodiscard static i8 hexDigit(char c) noexcept {
+        if (c >= '0' and c <= '9') { return static_cast<i8>(c - '0'); }
+        if (c >= 'A' and c <= 'F') { return static_cast<i8>(c - 'A' + 10); }
+        if (c >= 'a' and c <= 'f') { return static_cast<i8>(c - 'a' + 10); }
+        return -1;
+    }
+};
+
+/// @brief Horizontal alignment of laid out lines relative to anchor x
+enum class TextAlign : u8 {
+    Left,  ///< Line starts at anchor
+    Center,///< Line is centered on anchor
+    Right, ///< Line ends right before anchor (e.g. canvas width for flush right)
+};
+
+/// @brief Size of laid out text
+struct TextExtent {
+    Pixel width{0}; ///< Widest line, inter-glyph spacing included
+    Pixel height{0};///< Lines times line height
+    u16 lines{0};   ///< Number of lines
+};
+
+/// @brief Text run broken into lines by Canvas::layout
+/// @details Keeps line breaks and extents of a run for current font, text scale and wrapping,
+/// so labels are laid out once and drawn (aligned) every frame with Canvas::text.
+/// Line storage is provided by the caller.
+struct TextLayout final {
+    template<PixelFormat, typename> friend struct Canvas;
+
+    /// @brief Laid out line
+    struct Line {
+        u16 first; ///< Index of first token in run
+        u16 count; ///< Number of tokens (line break excluded)
+        Pixel width;///< Line width, inter-glyph spacing included
+    };
+
+private:
+    const TextRun *source{nullptr};///< Laid out run
+    Slice<Line> storage;           ///< Line storage
+    u16 line_count{0};             ///< Used lines
+    TextExtent box{};              ///< Size of all lines
+
+public:
+    /// @brief Create empty layout over caller-provided storage
+    explicit TextLayout(Slice<Line> storage) noexcept:
+        storage{storage} {}
+
+    /// @brief Laid out run (nullptr before layout)
+    kf_nodiscard const TextRun *run() const noexcept { return source; }
+
+    /// @brief Size of laid out text
+    kf_nodiscard const TextExtent &extent() const noexcept { return box; }
+
+    /// @brief Number of lines
+    kf_nodiscard u16 size() const noexcept { return line_count; }
+
+    kf_nodiscard const Line *begin() const noexcept { return storage.data(); }
+
+    kf_nodiscard const Line *end() const noexcept { return storage.data() + line_count; }
+};
+
+}// namespace kf::gfx
@@ -33,6 +33,7 @@ template<usize N> struct TextBufferRender : Render<TextBufferRender<N>> {
         Glyph float_places{2};          ///< Decimal places for float
         Glyph double_places{4};         ///< Decimal places for double
         bool title_centered{true};      ///< Render Title centered
+        bool skip_unchanged{true};      ///< Skip on_render_finish when frame text equals previous frame
 
         Config(const Config &) = delete;
     };
@@ -40,12 +41,20 @@ template<usize N> struct TextBufferRender : Render<TextBufferRender<N>> {
     Config config{};          ///< Current renderer configuration
     ArrayString<N> buffer{};  ///< Output buffer for rendered text
 
+    /// @brief Force next frame to be delivered even if unchanged (e.g. after display reinit)
+    void invalidate() noexcept { previous_valid = false; }
+
 private:
+    ArrayString<N> previous{};  ///< Text of last delivered frame
+    bool previous_valid{false}; ///< Whether previous holds delivered frame
+
     /// @brief Cursor state for tracking rendering position
     struct Cursor {
         Glyph row{0};        ///< Current row position
         Glyph col{0};        ///< Current column position
         bool contrast{false};///< Whether we're in contrast mode
+        u8 control{0};       ///< Control sequence state: 0 - none, 1 - command follows, 2 - argument follows
+        bool dropped{false}; ///< Whether last character was dropped (its UTF-8 continuation bytes too)
 
         /// @brief Reset cursor to beginning
         void reset() { *this = {}; }
@@ -72,28 +81,65 @@ private:
     } cursor;
 
     /// @brief Helper to write character with cursor tracking
-    /// @param ch Character to write
+    /// @param ch Character (UTF-8 byte) to write
+    /// @details Control sequences (ESC command [argument], see gfx::TextControl)
+    /// and UTF-8 continuation bytes take no columns.
     void writeChar(char ch) noexcept {
         if (buffer.full()) { return; }
         if (cursor.row >= config.rows_total) { return; }
 
+        if (cursor.control == 2) {
+            cursor.control = 0;
+            (void) buffer.push(ch);
+            return;
+        }
+
+        if (cursor.control == 1) {
+            cursor.control = 0;
+
+            switch (ch) {
+                case 'I': // Start contrast
+                    cursor.contrast = true;
+                    break;
+
+                case 'N': // End contrast
+                    cursor.contrast = false;
+                    break;
+
+                case 'F': // Color commands take hex digit argument
+                case 'B':
+                    cursor.control = 2;
+                    break;
+
+                default:
+                    break;
+            }
+
+            (void) buffer.push(ch);
+            return;
+        }
+
         switch (ch) {
             case '\n':cursor.newline();
                 break;
 
-            case '\x81': // Start contrast
-                cursor.contrast = true;
-                break;
-
-            case '\x80': // End contrast
-                cursor.contrast = false;
+            case '\033': // Control sequence, command follows
+                cursor.control = 1;
                 break;
 
             default:
-                if (not cursor.canWrite(config.row_max_length)) {
+                if ((static_cast<u8>(ch) & 0xC0) == 0x80) {
+                    // UTF-8 continuation byte belongs to previous character
+                    if (cursor.dropped) { return; }
+                    break;
+                }
+
+                cursor.dropped = not cursor.canWrite(config.row_max_length);
+                if (cursor.dropped) {
                     // If row is full, and we're in contrast mode, exit it
                     if (cursor.contrast) {
-                        (void) buffer.push('\x80');
+                        (void) buffer.push('\033');
+                        (void) buffer.push('N');
                         cursor.contrast = false;
                     }
                     return;
@@ -105,6 +151,26 @@ private:
         (void) buffer.push(ch);
     }
 
+    /// @brief Number of columns text takes (control sequences and UTF-8 continuation bytes excluded)
+    kf_nodiscard static usize columns(StringView text) noexcept {
+        usize count = 0;
+        u8 control = 0;
+
+        for (char ch: text) {
+            if (control == 2) {
+                control = 0;
+            } else if (control == 1) {
+                control = (ch == 'F' or ch == 'B') ? 2 : 0;
+            } else if (ch == '\033') {
+                control = 1;
+            } else if (ch != '\n' and (static_cast<u8>(ch) & 0xC0) != 0x80) {
+                count += 1;
+            }
+        }
+
+        return count;
+    }
+
     /// @brief Write string with cursor tracking
     void writeString(StringView str) noexcept {
         for (char ch: str) {
@@ -136,28 +202,34 @@ private:
     }
 
     void finishImpl() noexcept {
+        if (config.skip_unchanged) {
+            if (previous_valid and previous == buffer.view()) { return; }
+
+            previous = buffer.view();
+            previous_valid = true;
+        }
+
         if (config.on_render_finish) {
             config.on_render_finish(buffer.view());
         }
     }
 
     void titleImpl(StringView title) noexcept {
-        writeChar('\xF0');
-        writeChar('\xBC');
+        writeString("\033F0\033BC");
         if (config.title_centered) {
-            const auto spaces = kf::max(0, (int(config.row_max_length) - int(title.size())) / 2);
+            const auto spaces = kf::max(0, (int(config.row_max_length) - int(columns(title))) / 2);
             for (int i = 0; i < spaces; i += 1) {
                 writeChar(' ');
             }
         }
         writeString(title);
         writeChar('\n');
-        writeChar('\x80');
+        writeString("\033N");
     }
 
     void checkboxImpl(bool enabled) noexcept {
-        constexpr StringView on{"==\xB2( 1 )\x80"};
-        constexpr StringView off{"\xB1( 0 )\x80--"};
+        constexpr StringView on{"==\033B2( 1 )\033N"};
+        constexpr StringView off{"\033B1( 0 )\033N--"};
         writeString(enabled ? on : off);
     }
 
@@ -165,8 +237,8 @@ private:
     void valueImpl(StringView str) noexcept { writeString(str); }
 
     void valueImpl(bool value) noexcept {
-        constexpr StringView _true{"\xF2true\x80"};
-        constexpr StringView _false{"\xF1""false\x80"};
+        constexpr StringView _true{"\033F2true\033N"};
+        constexpr StringView _false{"\033F1false\033N"};
         writeString(value ? _true : _false);
     }
 
@@ -190,9 +262,9 @@ private:
 
     void colonImpl() noexcept { writeString(": "); }
 
-    void beginFocusedImpl() noexcept { writeChar('\x81'); }
+    void beginFocusedImpl() noexcept { writeString("\033I"); }
 
-    void endFocusedImpl() noexcept { writeChar('\x80'); }
+    void endFocusedImpl() noexcept { writeString("\033N"); }
 
     void beginBlockImpl() noexcept { writeChar('['); }
 
@@ -0,0 +1,122 @@
+// Copyright (c) 2026 KiraFlux
+// SPDX-License-Identifier: MIT
+
+// Host benchmark: pixel_traits<RGB565> fill/copy against the former per-pixel loops
+//
+// Build & run (from repository root):
+//   g++ -std=c++17 -O2 -Isrc tools/bench_pixel_traits.cpp -o bench_pixel_traits
+//   ./bench_pixel_traits
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "kf/core/pixel_traits.hpp"
+
+using namespace kf;
+
+namespace {
+
+using Traits = pixel_traits<PixelFormat::RGB565>;
+using BufferType = Traits::BufferType;
+
+constexpr Pixel screen_width = 128;
+constexpr Pixel screen_height = 160;
+constexpr int iterations = 2000;
+
+BufferType screen[screen_width * screen_height];
+BufferType reference[screen_width * screen_height];
+BufferType sprite[32 * 32];
+
+/// @brief Former fill loop (per-pixel store)
+void legacyFill(BufferType *buffer, Pixel stride, Pixel offset_x, Pixel offset_y, Pixel width, Pixel height, BufferType color) {
+    for (usize y = 0; y < static_cast<usize>(height); y += 1) {
+        const auto abs_y = offset_y + y;
+        const usize row_start = abs_y * stride + offset_x;
+
+        for (usize x = 0; x < static_cast<usize>(width); x += 1) {
+            buffer[row_start + x] = color;
+        }
+    }
+}
+
+/// @brief Former copy loop (per-pixel store with per-pixel bound checks)
+void legacyCopy(const BufferType *source, Pixel source_width, Pixel source_height, BufferType *dest, Pixel dest_stride, Pixel dest_width, Pixel dest_height, Pixel dest_x, Pixel dest_y) {
+    if (dest_x >= dest_width or dest_y >= dest_height) { return; }
+
+    int copy_width = source_width;
+    int copy_height = source_height;
+
+    if (dest_x + copy_width > dest_width) { copy_width = dest_width - dest_x; }
+    if (dest_y + copy_height > dest_height) { copy_height = dest_height - dest_y; }
+
+    if (copy_width <= 0 or copy_height <= 0) { return; }
+
+    for (int y = 0; y < copy_height; y += 1) {
+        const auto dest_row = dest_y + y;
+        if (dest_row >= dest_height) { break; }
+
+        const usize src_row_start = y * source_width;
+        const usize dest_row_start = dest_row * dest_stride + dest_x;
+
+        for (int x = 0; x < copy_width; x += 1) {
+            const auto dest_col = dest_x + x;
+            if (dest_col >= dest_width) { break; }
+
+            dest[dest_row_start + x] = source[src_row_start + x];
+        }
+    }
+}
+
+template<typename F> double measure(F &&f) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i += 1) {
+        f(i);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+void report(const char *name, double legacy_us, double current_us, bool same) {
+    std::printf("%-28s legacy %8.2f us  current %8.2f us  x%5.2f  %s\n",
+                name, legacy_us, current_us, legacy_us / current_us, same ? "ok" : "MISMATCH");
+}
+
+void benchFill(const char *name, Pixel x, Pixel y, Pixel w, Pixel h) {
+    const double legacy_us = measure([&](int i) {
+        legacyFill(reference, screen_width, x, y, w, h, static_cast<BufferType>(i));
+    });
+    const double current_us = measure([&](int i) {
+        Traits::fill(screen, screen_width, x, y, w, h, static_cast<BufferType>(i));
+    });
+    report(name, legacy_us, current_us, 0 == std::memcmp(screen, reference, sizeof(screen)));
+}
+
+void benchCopy(const char *name, Pixel x, Pixel y, Pixel w, Pixel h) {
+    const double legacy_us = measure([&](int) {
+        legacyCopy(sprite, w, h, reference, screen_width, screen_width, screen_height, x, y);
+    });
+    const double current_us = measure([&](int) {
+        Traits::copy(screen, screen_width, 0, 0, screen_width, screen_height, x, y, sprite, w, h);
+    });
+    report(name, legacy_us, current_us, 0 == std::memcmp(screen, reference, sizeof(screen)));
+}
+
+}// namespace
+
+int main() {
+    for (usize i = 0; i < sizeof(sprite) / sizeof(sprite[0]); i += 1) {
+        sprite[i] = static_cast<BufferType>(i * 2654435761u);
+    }
+
+    benchFill("fill full screen", 0, 0, screen_width, screen_height);
+    benchFill("fill sub-canvas 100x40", 13, 17, 100, 40);
+    benchFill("fill text line 128x9", 0, 50, screen_width, 9);
+    benchFill("fill odd 3x160", 7, 0, 3, screen_height);
+
+    benchCopy("copy icon 16x16", 21, 33, 16, 16);
+    benchCopy("copy sprite 32x32", 11, 3, 32, 32);
+    benchCopy("copy clipped 32x32", 110, 140, 32, 32);
+
+    return 0;
+}
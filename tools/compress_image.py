@@ -0,0 +1,216 @@
+"""
+Encode image into kf::gfx::CompressedImage initializer
+
+RGB565: RLE of pixels (run header 0x8000 | count, then color; literal header count, then pixels)
+Monochrome: page-wise packbits (page layout bytes, bit 0 of each column byte is the top pixel)
+Gray4, RGB332: RLE of pixels (run header 0x80 | count - 1, then value; literal header count - 1,
+then pixels packed as in buffer rows, left pixel in high nibble for Gray4)
+
+Usage (requires Pillow):
+    python compress_image.py logo.png logo --format rgb565 > logo.hpp
+    python compress_image.py icon.png icon --format mono --threshold 128 > icon.hpp
+    python compress_image.py photo.png photo --format gray4 > photo.hpp
+"""
+
+import argparse
+import sys
+from pathlib import Path
+
+RGB565_RUN_FLAG = 0x8000
+RGB565_MAX_COUNT = 0x7FFF
+RGB565_MIN_RUN = 3
+
+PACKBITS_MAX_COUNT = 128
+PACKBITS_MIN_RUN = 3
+
+PACKED_RUN_FLAG = 0x80
+PACKED_MAX_COUNT = 128
+PACKED_MIN_RUN = 3
+
+FORMATS = {
+    # name: (C++ format, hex digits, values per line)
+    "rgb565": ("RGB565", 4, 12),
+    "mono": ("Monochrome", 2, 16),
+    "gray4": ("Gray4", 2, 16),
+    "rgb332": ("RGB332", 2, 16),
+}
+
+
+def rgb565(r: int, g: int, b: int) -> int:
+    """Color in buffer byte order (same as pixel_traits<RGB565>::fromRgb)"""
+    color = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+    return ((color & 0xFF) << 8) | (color >> 8)
+
+
+def rgb332(r: int, g: int, b: int) -> int:
+    """Same as pixel_traits<RGB332>::fromRgb"""
+    return (r & 0xE0) | ((g & 0xE0) >> 3) | (b >> 6)
+
+
+def luma(r: int, g: int, b: int) -> int:
+    return (r * 77 + g * 150 + b * 29) >> 8
+
+
+def run_length(values: list, start: int, limit: int) -> int:
+    end = start + 1
+    while end < len(values) and end - start < limit and values[end] == values[start]:
+        end += 1
+    return end - start
+
+
+def encode_rgb565(pixels: list) -> list:
+    """Encode row-major buffer values into RLE words"""
+    words = []
+    literal = []
+
+    def flush_literal():
+        for i in range(0, len(literal), RGB565_MAX_COUNT):
+            chunk = literal[i:i + RGB565_MAX_COUNT]
+            words.append(len(chunk))
+            words.extend(chunk)
+        literal.clear()
+
+    i = 0
+    while i < len(pixels):
+        run = run_length(pixels, i, RGB565_MAX_COUNT)
+
+        if run >= RGB565_MIN_RUN:
+            flush_literal()
+            words.extend((RGB565_RUN_FLAG | run, pixels[i]))
+        else:
+            literal.extend(pixels[i:i + run])
+
+        i += run
+
+    flush_literal()
+    return words
+
+
+def encode_packbits(data: list) -> list:
+    """Encode page layout bytes with packbits"""
+    out = []
+    literal = []
+
+    def flush_literal():
+        for i in range(0, len(literal), PACKBITS_MAX_COUNT):
+            chunk = literal[i:i + PACKBITS_MAX_COUNT]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+        literal.clear()
+
+    i = 0
+    while i < len(data):
+        run = run_length(data, i, PACKBITS_MAX_COUNT)
+
+        if run >= PACKBITS_MIN_RUN:
+            flush_literal()
+            out.extend(((1 - run) & 0xFF, data[i]))
+        else:
+            literal.extend(data[i:i + run])
+
+        i += run
+
+    flush_literal()
+    return out
+
+
+def encode_packed(pixels: list, bits: int) -> list:
+    """Encode row-major pixel values of 4 or 8 bit format into RLE bytes"""
+    out = []
+    literal = []
+
+    def pack(chunk):
+        if bits == 8:
+            return list(chunk)
+        padded = list(chunk) + [0] * (len(chunk) % 2)
+        return [(padded[i] << 4) | padded[i + 1] for i in range(0, len(padded), 2)]
+
+    def flush_literal():
+        for i in range(0, len(literal), PACKED_MAX_COUNT):
+            chunk = literal[i:i + PACKED_MAX_COUNT]
+            out.append(len(chunk) - 1)
+            out.extend(pack(chunk))
+        literal.clear()
+
+    i = 0
+    while i < len(pixels):
+        run = run_length(pixels, i, PACKED_MAX_COUNT)
+
+        if run >= PACKED_MIN_RUN:
+            flush_literal()
+            out.extend((PACKED_RUN_FLAG | (run - 1), pixels[i]))
+        else:
+            literal.extend(pixels[i:i + run])
+
+        i += run
+
+    flush_literal()
+    return out
+
+
+def to_pages(bits: list, width: int, height: int) -> list:
+    """Pack row-major 0/1 pixels into page layout bytes"""
+    pages = (height + 7) // 8
+    data = [0] * (width * pages)
+
+    for y in range(height):
+        for x in range(width):
+            if bits[y * width + x]:
+                data[(y // 8) * width + x] |= 1 << (y % 8)
+
+    return data
+
+
+def format_initializer(name: str, pixel_format: str, width: int, height: int, stream: list, raw_size: int) -> str:
+    cpp_format, digits, per_line = FORMATS[pixel_format]
+
+    lines = [
+        f"// Generated by tools/compress_image.py: {width}x{height} {cpp_format}, "
+        f"{len(stream)} elements (raw {raw_size})",
+        f"static constexpr kf::gfx::CompressedImage<kf::PixelFormat::{cpp_format}, {width}, {height}, {len(stream)}> {name}{{{{",
+    ]
+
+    for i in range(0, len(stream), per_line):
+        chunk = stream[i:i + per_line]
+        lines.append("    " + ", ".join(f"0x{value:0{digits}X}" for value in chunk) + ",")
+
+    lines.append("}};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Encode image into kf::gfx::CompressedImage")
+    parser.add_argument("image", type=Path, help="Source image file")
+    parser.add_argument("name", help="C++ variable name")
+    parser.add_argument("--format", choices=tuple(FORMATS), default="rgb565")
+    parser.add_argument("--threshold", type=int, default=128, help="Monochrome threshold of luminance (0..255)")
+    args = parser.parse_args()
+
+    from PIL import Image
+
+    image = Image.open(args.image).convert("RGB")
+    width, height = image.size
+    pixels = list(image.getdata())
+
+    if args.format == "rgb565":
+        values = [rgb565(r, g, b) for r, g, b in pixels]
+        stream = encode_rgb565(values)
+        raw_size = width * height
+    elif args.format == "gray4":
+        stream = encode_packed([luma(r, g, b) >> 4 for r, g, b in pixels], 4)
+        raw_size = (width + 1) // 2 * height
+    elif args.format == "rgb332":
+        stream = encode_packed([rgb332(r, g, b) for r, g, b in pixels], 8)
+        raw_size = width * height
+    else:
+        bits = [(r * 299 + g * 587 + b * 114) // 1000 >= args.threshold for r, g, b in pixels]
+        pages = to_pages(bits, width, height)
+        stream = encode_packbits(pages)
+        raw_size = len(pages)
+
+    print(format_initializer(args.name, args.format, width, height, stream, raw_size))
+    print(f"{args.image}: {raw_size} -> {len(stream)} elements", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,253 @@
+"""
+Compile bitmap (BDF) or outline (TTF/OTF, rasterized with Pillow) font into kf::gfx::Font arrays
+
+Glyphs are stored in page layout: for each 8-pixel page, one byte per column, bit 0 is the top pixel.
+Proportional fonts get per-glyph widths and data offsets, sparse code points get a range table.
+
+Usage:
+    python font_compiler.py terminus.bdf terminus_8x16 --chars 32-126 --monospace > terminus.hpp
+    python font_compiler.py Roboto.ttf roboto_12 --size 12 --chars 32-126,0x410-0x44F > roboto.hpp
+"""
+
+import argparse
+import sys
+from pathlib import Path
+
+ASCII_RANGE = (32, 127)
+
+
+def parse_chars(text: str) -> list:
+    """Parse "32-126,0x410-0x44F,0xB0" into sorted code point list"""
+    codes = set()
+
+    for part in text.split(","):
+        bounds = part.split("-")
+        first = int(bounds[0], 0)
+        last = int(bounds[-1], 0)
+        codes.update(range(first, last + 1))
+
+    return sorted(codes)
+
+
+class Glyph:
+    """Rasterized glyph: rows of 0/1 pixels, width x height of font"""
+
+    def __init__(self, width: int, rows: list):
+        self.width = width
+        self.rows = rows
+
+
+def load_bdf(path: Path, codes: list) -> tuple:
+    """Load glyphs from BDF font, placed on common baseline"""
+    ascent = descent = 0
+    glyphs = {}
+    current = {}
+    bitmap = None
+
+    for line in path.read_text(encoding="latin-1").splitlines():
+        words = line.split()
+        if not words:
+            continue
+
+        key = words[0]
+
+        if key == "FONT_ASCENT":
+            ascent = int(words[1])
+        elif key == "FONT_DESCENT":
+            descent = int(words[1])
+        elif key == "STARTCHAR":
+            current = {}
+        elif key == "ENCODING":
+            current["code"] = int(words[1])
+        elif key == "DWIDTH":
+            current["advance"] = int(words[1])
+        elif key == "BBX":
+            current["bbx"] = tuple(int(word) for word in words[1:5])
+        elif key == "BITMAP":
+            bitmap = []
+        elif key == "ENDCHAR":
+            current["bitmap"] = bitmap
+            glyphs[current.get("code", -1)] = current
+            bitmap = None
+        elif bitmap is not None:
+            bitmap.append(int(key, 16))
+
+    height = ascent + descent
+    result = {}
+
+    for code in codes:
+        source = glyphs.get(code)
+        if source is None:
+            continue
+
+        box_width, box_height, offset_x, offset_y = source["bbx"]
+        width = max(source.get("advance", box_width), offset_x + box_width, 1)
+        rows = [[0] * width for _ in range(height)]
+        top = ascent - (box_height + offset_y)
+        row_bits = (box_width + 7) // 8 * 8
+
+        for y, value in enumerate(source["bitmap"]):
+            for x in range(box_width):
+                if value >> (row_bits - 1 - x) & 1:
+                    cell_x = offset_x + x
+                    cell_y = top + y
+                    if 0 <= cell_x < width and 0 <= cell_y < height:
+                        rows[cell_y][cell_x] = 1
+
+        result[code] = Glyph(width, rows)
+
+    return result, height
+
+
+def load_outline(path: Path, codes: list, size: int, threshold: int) -> tuple:
+    """Rasterize glyphs of TTF/OTF font with Pillow"""
+    from PIL import Image, ImageDraw, ImageFont
+
+    font = ImageFont.truetype(str(path), size)
+    ascent, descent = font.getmetrics()
+    height = ascent + descent
+    result = {}
+
+    for code in codes:
+        char = chr(code)
+        advance = max(1, round(font.getlength(char)))
+        image = Image.new("L", (advance + size, height), 0)
+        ImageDraw.Draw(image).text((0, 0), char, font=font, fill=255)
+
+        rows = [[1 if image.getpixel((x, y)) >= threshold else 0 for x in range(advance)] for y in range(height)]
+        result[code] = Glyph(advance, rows)
+
+    return result, height
+
+
+def trim(glyph: Glyph) -> Glyph:
+    """Drop advance spacing right of ink (Canvas adds 1 pixel between glyphs)"""
+    ink = [x for row in glyph.rows for x, bit in enumerate(row) if bit]
+    width = max(ink) + 1 if ink else max(1, glyph.width - 1)
+    return Glyph(width, [row[:width] for row in glyph.rows])
+
+
+def to_pages(glyph: Glyph, width: int, height: int) -> list:
+    """Pack glyph into page layout bytes, width columns per page"""
+    data = []
+
+    for page in range((height + 7) // 8):
+        for x in range(width):
+            value = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and x < glyph.width and glyph.rows[y][x]:
+                    value |= 1 << bit
+            data.append(value)
+
+    return data
+
+
+def build_ranges(codes: list) -> list:
+    """Group sorted code points into (first, count, glyph index) ranges"""
+    ranges = []
+
+    for index, code in enumerate(codes):
+        if ranges and ranges[-1][0] + ranges[-1][1] == code:
+            ranges[-1][1] += 1
+        else:
+            ranges.append([code, 1, index])
+
+    return ranges
+
+
+def format_array(cpp_type: str, name: str, values: list, digits: int) -> list:
+    lines = [f"static constexpr {cpp_type} {name}[] = {{"]
+
+    for i in range(0, len(values), 16):
+        chunk = values[i:i + 16]
+        lines.append("    " + ", ".join(f"0x{value:0{digits}X}" if digits else str(value) for value in chunk) + ",")
+
+    lines.append("};")
+    return lines
+
+
+def compile_font(name: str, source: str, glyphs: dict, height: int, monospace: bool) -> str:
+    codes = sorted(glyphs)
+
+    if not monospace:
+        glyphs = {code: trim(glyph) for code, glyph in glyphs.items()}
+
+    cell_width = max(glyph.width for glyph in glyphs.values())
+
+    data = []
+    widths = []
+    offsets = []
+
+    for code in codes:
+        glyph = glyphs[code]
+        width = cell_width if monospace else glyph.width
+        offsets.append(len(data))
+        widths.append(width)
+        data.extend(to_pages(glyph, width, height))
+
+    if len(data) > 0xFFFF and not monospace:
+        raise ValueError("Proportional font data exceeds 64 KiB offsets")
+
+    ranges = build_ranges(codes)
+    is_ascii = len(ranges) == 1 and ranges[0][0] == ASCII_RANGE[0] and ranges[0][1] == ASCII_RANGE[1] - ASCII_RANGE[0]
+
+    lines = [
+        f"// Generated by tools/font_compiler.py from {source}: "
+        f"{len(codes)} glyphs, {cell_width}x{height}, {'monospaced' if monospace else 'proportional'}, {len(data)} bytes",
+    ]
+    lines += format_array("kf::u8", f"{name}_data", data, 2)
+
+    widths_name = offsets_name = ranges_name = "nullptr"
+
+    if not monospace:
+        widths_name = f"{name}_widths"
+        offsets_name = f"{name}_offsets"
+        lines += format_array("kf::u8", widths_name, widths, 0)
+        lines += format_array("kf::u16", offsets_name, offsets, 0)
+
+    if not is_ascii:
+        ranges_name = f"{name}_ranges"
+        lines.append(f"static constexpr kf::gfx::Font::Range {ranges_name}[] = {{")
+        lines += [f"    {{0x{first:04X}, {count}, {glyph}}}," for first, count, glyph in ranges]
+        lines.append("};")
+
+    lines.append(
+        f"constexpr kf::gfx::Font {name}{{{name}_data, {cell_width}, {height}, "
+        f"{widths_name}, {offsets_name}, {ranges_name}, {0 if is_ascii else len(ranges)}}};")
+
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile font into kf::gfx::Font")
+    parser.add_argument("font", type=Path, help="Source font file (.bdf, .ttf, .otf)")
+    parser.add_argument("name", help="C++ variable name")
+    parser.add_argument("--chars", default="32-126", help="Code points, e.g. 32-126,0x410-0x44F")
+    parser.add_argument("--size", type=int, default=8, help="Pixel size for outline fonts")
+    parser.add_argument("--threshold", type=int, default=128, help="Coverage threshold for outline fonts (0..255)")
+    parser.add_argument("--monospace", action="store_true", help="Store glyphs in equal cells")
+    args = parser.parse_args()
+
+    codes = parse_chars(args.chars)
+
+    if args.font.suffix.lower() == ".bdf":
+        glyphs, height = load_bdf(args.font, codes)
+    else:
+        glyphs, height = load_outline(args.font, codes, args.size, args.threshold)
+
+    if not glyphs:
+        sys.exit("No glyphs found for requested code points")
+
+    if len(glyphs) > 0xFFFF or height > 0xFF:
+        sys.exit("Font is too large")
+
+    missing = len(codes) - len(glyphs)
+    if missing:
+        print(f"{missing} code points have no glyph", file=sys.stderr)
+
+    print(compile_font(args.name, args.font.name, glyphs, height, args.monospace))
+
+
+if __name__ == "__main__":
+    main()